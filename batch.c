@@ -0,0 +1,168 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include "batch.h"
+
+/* Batch search of many unrelated positions. Each worker thread has its
+	own engine and takes the next unsearched position whenever it
+	finishes one, so the threads stay busy until the batch runs out and
+	throughput grows with the number of cores. All engines share one
+	large transposition table and the endgame cache, both lockless, so
+	positions that transpose into each other share their work.
+
+	Every position is searched with the tie-breaking seed of its index
+	in the batch. Even so, with more than one thread the results depend
+	on what the other threads have already stored in the shared tables,
+	and so on scheduling; only a batch searched on one thread is
+	reproducible. */
+
+struct batch {
+	int (*boards)[ARRSIZE];
+	int n;
+	const struct searchlimits *limits;
+	struct searchresult *results;
+	struct ttable *tt;
+	struct ecache *ec;
+	pthread_mutex_t lock;
+	int next;				/* Next position to search (guarded by lock) */
+};
+
+static void *worker(void *arg) {
+	struct batch *b = arg;
+	struct engine *e;
+	int i;
+
+	if ((e = engine_create()) == NULL)
+		return NULL;	// Other threads search its share
+	engine_settt(e, b->tt);
+	engine_setecache(e, b->ec);
+	engine_setlimits(e, b->limits);
+
+	for (;;) {
+		pthread_mutex_lock(&b->lock);
+		i = b->next++;
+		pthread_mutex_unlock(&b->lock);
+		if (i >= b->n)
+			break;
+
+		engine_newgame(e);
+		engine_setseed(e, i+1);
+		engine_setposition(e, b->boards[i]);
+		engine_search(e, &b->results[i]);
+	}
+	engine_destroy(e);
+	return NULL;
+}
+
+/** Search n positions with the same limits on nthreads threads and
+	store the outcome for boards[i] in results[i]. Positions that
+	couldn't be searched, because no thread could create its engine,
+	are left with a movenum of 0. Returns 0, or -1 if the tables or
+	threads couldn't be created or any position wasn't searched. */
+int batch_search(int (*boards)[ARRSIZE], int n, const struct searchlimits *limits,
+		struct searchresult *results, int nthreads) {
+	struct batch b = { boards, n, limits, results, NULL, NULL, PTHREAD_MUTEX_INITIALIZER, 0 };
+	pthread_t threads[nthreads];
+	int i, started;
+
+	if ((b.tt = tt_create(BATCH_TTSIZE)) == NULL || (b.ec = ec_create(EC_DEFAULTSIZE)) == NULL) {
+		tt_destroy(b.tt);
+		return -1;
+	}
+	for (i=0; i<n; i++)
+		results[i].movenum = 0;	// Set by engine_search()
+	tt_newsearch(b.tt);	// Once for the batch: its searches all count as current
+	for (started=0; started<nthreads; started++)
+		if (pthread_create(&threads[started], NULL, worker, &b) != 0)
+			break;
+	for (i=0; i<started; i++)
+		pthread_join(threads[i], NULL);
+
+	ec_destroy(b.ec);
+	tt_destroy(b.tt);
+	if (started == 0)
+		return -1;
+	for (i=0; i<n; i++)
+		if (results[i].movenum == 0)
+			return -1;
+	return 0;
+}
+
+static double now(void) {
+	struct timeval tv;
+	gettimeofday(&tv,NULL);
+	return tv.tv_sec+(tv.tv_usec/1000000.0);
+}
+
+/** Search every position in a file, one per line in the format read
+	by parseboard() (so the output of "--output compact" works), to the
+	given depth, and print one line per position in the file's order.
+	Returns 0, or -1 if the file couldn't be read or searched. */
+int batch_run(const char *fname, int nthreads, int depth) {
+	struct searchlimits limits = {0};
+	struct searchresult *results;
+	int (*boards)[ARRSIZE] = NULL, (*p)[ARRSIZE];
+	int i, n = 0, size = 0, line = 0;
+	char buf[4096], str[NUMTILES+2], move[8];
+	unsigned long nodes = 0;
+	double time;
+	FILE *fp;
+
+	if ((fp = fopen(fname,"r")) == NULL) {
+		fprintf(stderr,"Error: Could not open file \"%s\" for reading: %s\n",fname,strerror(errno));
+		return -1;
+	}
+	while (fgets(buf, sizeof buf, fp)) {
+		line++;
+		if (strspn(buf, " \t\r\n") == strlen(buf))
+			continue;
+		if (n == size) {
+			size = size ? 2*size : 256;
+			if ((p = realloc(boards, size * sizeof *boards)) == NULL) {
+				fprintf(stderr,"Error: Out of memory.\n");
+				goto fail;
+			}
+			boards = p;
+		}
+		if (parseboard(buf, boards[n++]) < 0) {
+			fprintf(stderr,"Error: Line %d of \"%s\" is formatted incorrectly.\n",line,fname);
+			goto fail;
+		}
+	}
+	fclose(fp);
+	fp = NULL;
+
+	if ((results = malloc((n ? n : 1) * sizeof *results)) == NULL) {
+		fprintf(stderr,"Error: Out of memory.\n");
+		goto fail;
+	}
+	limits.depth = depth;
+	time = now();
+	if (batch_search(boards, n, &limits, results, nthreads) < 0) {
+		fprintf(stderr,"Error: Could not search every position.\n");
+		free(results);
+		goto fail;
+	}
+	time = now()-time;
+
+	for (i=0; i<n; i++) {
+		printf("%s %s score %d depth %d nodes %lu\n", boardtostr(boards[i], str),
+				movetostr(results[i].move, move), results[i].score, results[i].depth, results[i].nodes);
+		nodes += results[i].nodes;
+	}
+	printf("\n%d positions  threads %d  nodes %lu  time %.3f  positions/s %.1f\n",
+			n, nthreads, nodes, time, time > 0 ? n/time : 0.0);
+
+	free(results);
+	free(boards);
+	return 0;
+
+fail:
+	if (fp)
+		fclose(fp);
+	free(boards);
+	return -1;
+}
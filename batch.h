@@ -0,0 +1,14 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "engine.h"
+
+#define BATCH_THREADS 4			/* Default number of worker threads */
+#define BATCH_TTSIZE (1<<26)	/* Bytes of the shared transposition table */
+#define BATCH_DEPTH 9			/* Default depth of batch_run() */
+
+int batch_search(int (*boards)[ARRSIZE], int n, const struct searchlimits *limits,
+		struct searchresult *results, int nthreads);
+int batch_run(const char *fname, int nthreads, int depth);
+
+#endif
@@ -0,0 +1,109 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "engine.h"
+#include "bench.h"
+
+/* Benchmark: fixed-depth searches of a built-in suite of positions,
+	each from an empty transposition table with the same tie-breaking
+	seed, so every run searches exactly the same trees. The checksum
+	of the node counts tells whether two builds searched the same trees;
+	if it matches, their nodes per second can be compared. Each board
+	size has its own suite; a depth of 0 solves the position. */
+
+static const struct {
+	const char *name;
+	const char *board;	/* parseboard() format */
+	int depth;
+} suite[] = {
+#if BOARDSIZE == 6
+	{ "start",		"0000000000000021000012000000000000001", 13 },
+	{ "midgame",	"1020000121000212112222201002000002001", 14 },
+	{ "endgame",	"1020000121000212112221102002102002001", 0 },
+#elif BOARDSIZE == 10
+	{ "start",		"00000000000000000000000000000000000000000000210000000012000000000000000000000000000000000000000000001", 9 },
+	{ "opening",	"00000000000000000000000000000000111222002222222100002221100000022110000000200000000000000000000000001", 7 },
+	{ "midgame",	"00000000000000000001002122221100222221200222111122002121111202211111100021100000000000000000000000001", 7 },
+	{ "late",		"00020020100022111200000211222000221122000022122220001212212000122112220012221222002112210002222220101", 8 },
+#else
+	{ "start",		"00000000000000000000000000021000000120000000000000000000000000001", 11 },
+	{ "opening",	"00000000000000000010000000011220001122000002220000000000000000001", 9 },
+	{ "early",		"00000000000000000010200000012222001121200022221000021000002000001", 8 },
+	{ "midgame",	"00000000000000000010200100012212001121220022122200222200002222001", 9 },
+	{ "late",		"00000000000000020011222200122222002121220222122200222100011111101", 10 },
+	{ "endgame",	"00002100022221120022212211211222111121222112222201111100011111101", 14 },
+	{ "endgame2",	"10002100012221122012212222211222212121222112222201111100011111101", 12 },
+#endif
+};
+
+#define NUMSUITE ((int)(sizeof suite / sizeof *suite))
+#define BENCH_DEPTH 9	/* Depth for positions loaded from files */
+
+#ifdef PROFILE
+static struct profile benchprofile;	/* Of all positions together */
+static uint64_t benchticks;
+#endif
+
+/** Search one position and add it to the totals. */
+static void benchposition(struct engine *e, const char *name, int *board, int depth,
+		unsigned long *nodes, double *time, uint64_t *checksum) {
+	struct searchlimits limits = {0};
+	struct searchresult result;
+	char move[8];
+
+	limits.depth = depth;
+	engine_newgame(e);
+	engine_setseed(e, BENCH_SEED);
+	engine_setlimits(e, &limits);
+	engine_setposition(e, board);
+	engine_search(e, &result);
+#ifdef PROFILE
+	prof_merge(&benchprofile, &engine_profile(e)->total);
+	benchticks += engine_profile(e)->ticks;
+#endif
+
+	printf("%-12s depth %2d  nodes %10lu  time %8.3f  nps %9.0f  move %s\n", name, result.depth,
+			result.nodes, result.time, result.time > 0 ? result.nodes/result.time : 0.0,
+			movetostr(result.move, move));
+
+	*nodes += result.nodes;
+	*time += result.time;
+	*checksum = (*checksum ^ result.nodes) * 0x100000001b3ULL; // FNV-1a
+}
+
+/** Run the benchmark. If depth isn't 0 every position is searched to
+	that depth instead of its own. Positions from the given files
+	(loadboard() format) are searched after the built-in ones. 
+	Returns 0, or -1 if a file couldn't be read. */
+int bench_run(int depth, int nfiles, char **files) {
+	struct engine *e;
+	int i, board[ARRSIZE];
+	unsigned long nodes = 0;
+	double time = 0;
+	uint64_t checksum = 0xcbf29ce484222325ULL;
+
+	for (i=0; i<nfiles; i++) // Check the files before spending time on the rest
+		if (loadboard(files[i], board) < 0)
+			return -1;
+	if ((e = engine_create()) == NULL) {
+		fprintf(stderr,"Error: Could not create the engine.\n");
+		return -1;
+	}
+
+	for (i=0; i<NUMSUITE; i++) {
+		parseboard(suite[i].board, board);
+		benchposition(e, suite[i].name, board, depth ? depth : suite[i].depth, &nodes, &time, &checksum);
+	}
+	for (i=0; i<nfiles; i++) {
+		loadboard(files[i], board);
+		benchposition(e, files[i], board, depth ? depth : BENCH_DEPTH, &nodes, &time, &checksum);
+	}
+
+	printf("\nTotal nodes %lu  time %.3f  nps %.0f  checksum %016llx\n", nodes, time,
+			time > 0 ? nodes/time : 0.0, (unsigned long long)checksum);
+#ifdef PROFILE
+	printf("\n");
+	prof_table(stdout, &benchprofile, benchticks);
+#endif
+	engine_destroy(e);
+	return 0;
+}
@@ -0,0 +1,8 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#define BENCH_SEED 1	/* Tie-breaking seed used for every position */
+
+int bench_run(int depth, int nfiles, char **files);
+
+#endif
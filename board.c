@@ -0,0 +1,556 @@
+#include <ctype.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "othello.h"
+#include "tables.h"
+#include "profile.h"
+
+const int dirs[] = {
+	NW, N, NE,
+	 W,     E,
+	SW, S, SE
+};
+
+/* flipdir[], positions[] and zobrist[] are in tables.h, generated
+	for each board size by gentables.c. */
+
+#define INCR_STABILITY(board,pos) 			\
+		COLFILLED(board,sq_x[pos])++; 		\
+		ROWFILLED(board,sq_y[pos])++; 		\
+		DIAG1FILLED(board,sq_diag1[pos])++; \
+		DIAG2FILLED(board,sq_diag2[pos])++ 
+
+#define DECR_STABILITY(board,pos) 			\
+		COLFILLED(board,sq_x[pos])--; 		\
+		ROWFILLED(board,sq_y[pos])--; 		\
+		DIAG1FILLED(board,sq_diag1[pos])--; \
+		DIAG2FILLED(board,sq_diag2[pos])-- 
+
+// Squares counted by h_pmobility(): those not on an edge
+#define ISINNER(pos) (sq_x[pos]-1u < BOARDSIZE-2u && sq_y[pos]-1u < BOARDSIZE-2u)
+
+/** Number of squares next to pos that are empty or are the
+	square move. */
+static inline int emptyaround(const int *board, int pos, int move) {
+	int j, count = 0;
+	for (j=0; j<8; j++)
+		count += board[pos+dirs[j]] == EMPTY || pos+dirs[j] == move;
+	return count;
+}
+
+/** Bring the running totals of the heuristics up to date with a
+	move that has just flipped the count pieces in flipped[]. The
+	pieces are taken as flipped before the move's own square is filled,
+	so each flipped piece is seen with the move's square still empty. */
+static void updatetotals(int *board, int move, const uint8_t *flipped, int count) {
+	int player = board[move];
+	int i, j, pos, ds = disksquare[move], fr = 0;
+	
+	for (i=0; i<count; i++) {
+		pos = flipped[i];
+		ds += 2*disksquare[pos];
+		if (ISINNER(pos))
+			fr -= 2*emptyaround(board, pos, move);
+	}
+	if (ISINNER(move))
+		fr -= emptyaround(board, move, -1);
+	fr *= player;
+	
+	// Occupied neighbors lose the move's square as an empty neighbor
+	for (j=0; j<8; j++) {
+		pos = move+dirs[j];
+		if ((board[pos] == PLAYER1 || board[pos] == PLAYER2) && ISINNER(pos))
+			fr += board[pos];
+	}
+	
+	DISKSQUARE(board) += player*ds;
+	FRONTIER(board) += fr;
+	PARITY(board) ^= 1 << quadrant[move];
+}
+		
+/** Apply the move and keep track of which pieces were
+	flipped in the "flipped" array so the move can be undone.	*/
+void results(int *board, int move, int *flipped) {
+	struct undo u;
+	int i;
+	
+	makemove(board, move, &u);
+	for (i=0; i<u.nflipped; i++)
+		flipped[i] = u.flipped[i];
+	flipped[i] = -1;
+}
+
+/** Apply the move (-1 to pass), recording in *u everything 
+	undomove() needs to take it back. */
+void makemove(int *board, int move, struct undo *u) {
+	int player = TURN(board);
+	int j, n, count, pos;
+	
+	u->move = move;
+	u->nflipped = u->nstable = 0;
+	TURN(board) = -player;
+	if (move == -1) // No legal moves
+		return;
+	
+	u->justplayed = JUSTPLAYED(board);
+	u->p1numstable = P1NUMSTABLE(board);
+	u->totalnumstable = TOTALNUMSTABLE(board);
+	u->disksquare = DISKSQUARE(board);
+	u->frontier = FRONTIER(board);
+	
+	count = 0;
+	board[move] = player;
+	ACTIVEPIECES(board)++;
+	for (j=0; j<8; j++) { // Check each direction
+		if (flipdir[pos = move] & (1<<j)) {
+			for (n=0, pos+=dirs[j]; board[pos]==-player; n++, pos+=dirs[j]); 
+			if (n>0 && board[pos]==player) {
+				for (pos-=dirs[j]; board[pos]==-player; pos-=dirs[j]) {
+					board[pos] = player;
+					u->flipped[count++] = pos;
+				}
+			}
+		}
+	}
+	u->nflipped = count;
+	
+	if (player == PLAYER1)
+		P1PIECES(board) += count+1;
+	else
+		P1PIECES(board) -= count;
+		
+	JUSTPLAYED(board) = move;
+	updatetotals(board, move, u->flipped, count);
+	
+	INCR_STABILITY(board,move);
+	u->nstable = PROF(PROF_STABILITY, updatestability(board, u->stable));
+}
+
+/** Take back a move applied by makemove(). */
+void undomove(int *board, const struct undo *u) {
+	int i, player = -TURN(board);
+	
+	TURN(board) = player;
+	if (u->move == -1)
+		return;
+	
+	for (i=0; i<u->nstable; i++)
+		STABLE(board,u->stable[i]) = 0;
+	P1NUMSTABLE(board) = u->p1numstable;
+	TOTALNUMSTABLE(board) = u->totalnumstable;
+	DISKSQUARE(board) = u->disksquare;
+	FRONTIER(board) = u->frontier;
+	PARITY(board) ^= 1 << quadrant[u->move];
+	DECR_STABILITY(board,u->move);
+	
+	for (i=0; i<u->nflipped; i++)
+		board[u->flipped[i]] = -player;
+	board[u->move] = EMPTY;
+	
+	ACTIVEPIECES(board)--;
+	if (player == PLAYER1)
+		P1PIECES(board) -= u->nflipped+1;
+	else
+		P1PIECES(board) += u->nflipped;
+	JUSTPLAYED(board) = u->justplayed;
+}
+		
+/** Mark the piece at position i as stable. */
+static inline int markstable(int *board, int i, uint8_t *newstable, int count) {
+	STABLE(board,i) = 1;
+	TOTALNUMSTABLE(board)++;
+	
+	//printf("%c%d is stable\n",GETX(i)+'A',GETY(i)+1);
+	
+	if (board[i] == PLAYER1)
+		P1NUMSTABLE(board)++;
+	if (newstable)
+		newstable[count] = i;
+	return count+1;
+}
+
+/** Mark pieces that have become stable. If newstable isn't NULL 
+	their positions are stored in it. Returns how many there were. 
+	
+	Pieces on an edge can only be flipped along the edge, so they are
+	looked up in edgestable[]. Any other piece is stable if, along 
+	each of the four lines through it, either the line is full or a 
+	neighbor on that line is a stable piece of the same color. */
+int updatestability(int *board, uint8_t *newstable) {
+	int i, j, e, v, index, mask, count = 0;
+	
+	for (e=0; e<4; e++) {
+		for (j=0, index=0; j<BOARDSIZE; j++) {
+			v = board[edges[e][j]];
+			index = index*3 + ((v<0) ? 2 : v);
+		}
+		for (j=0, mask=edgestable[index]; mask; j++, mask>>=1) {
+			i = edges[e][j];
+			if ((mask & 1) && STABLE(board,i) == 0)
+				count = markstable(board, i, newstable, count);
+		}
+	}
+	
+	for (j=0; j<NUMINNER; j++) {
+		i = inner[j];
+		if (STABLE(board,i) == 0 && board[i] != EMPTY) {
+			if ((COLFILLED(board,sq_x[i])==BOARDSIZE) || 
+				(board[i+ N]==board[i] && STABLE(board,i+N )) ||
+				(board[i+ S]==board[i] && STABLE(board,i+S )))
+			if ((ROWFILLED(board,sq_y[i])==BOARDSIZE) || 
+				(board[i+ W]==board[i] && STABLE(board,i+ W)) ||
+				(board[i+ E]==board[i] && STABLE(board,i+ E)))
+			if ((DIAG1FILLED(board,sq_diag1[i])==BOARDSIZE) ||
+				(board[i+NE]==board[i] && STABLE(board,i+NE)) ||
+				(board[i+SW]==board[i] && STABLE(board,i+SW)))
+			if ((DIAG2FILLED(board,sq_diag2[i])==BOARDSIZE) ||
+				(board[i+NW]==board[i] && STABLE(board,i+NW)) ||
+				(board[i+SE]==board[i] && STABLE(board,i+SE))) 
+				count = markstable(board, i, newstable, count);
+		}
+	}
+	return count;
+}
+		 
+/** Unflip the flipped pieces in the "flipped" array. */
+void unflip(int *board, int *flipped) {
+	int i;
+	for (i=0; flipped[i]!=-1; i++)
+		board[flipped[i]] = TURN(board);
+	board[JUSTPLAYED(board)] = EMPTY;
+}
+
+/** Check if the opponent's turn would be skipped if 
+	this were their turn. Used in terminaltest().	 */
+int oppskipcheck(int *board) {
+	int count;
+
+	TURN(board) = -TURN(board);
+	count = genmoves(board,NULL);
+	TURN(board) = -TURN(board);
+	
+	return count == 0;
+}		
+
+/** Compute the hash of a position from scratch. */
+uint64_t hashboard(int *board) {
+	uint64_t hash = (TURN(board) == PLAYER2) ? ZOBRIST_TURN : 0;
+	int i;
+	
+	for (i=FIRSTSQ; i<=LASTSQ; i++)
+		if (board[i] == PLAYER1 || board[i] == PLAYER2)
+			hash ^= zobrist[i][board[i]==PLAYER2];
+	return hash;
+}
+
+/** Hash of the position reached by a move, given the hash before 
+	it, the player who moved and the undo record from makemove(). */
+uint64_t hashupdate(uint64_t hash, int player, const struct undo *u) {
+	int i;
+	
+	hash ^= ZOBRIST_TURN;
+	if (u->move == -1)
+		return hash;
+	
+	hash ^= zobrist[u->move][player==PLAYER2];
+	for (i=0; i<u->nflipped; i++)
+		hash ^= zobrist[u->flipped[i]][0] ^ zobrist[u->flipped[i]][1];
+	return hash;
+}
+
+/** Hash of the position the current player's move would lead to,
+	without making the move. */
+uint64_t hashmove(int *board, uint64_t hash, int move) {
+	int player = TURN(board), j, n, pos;
+	const uint64_t *flip;
+	
+	hash ^= ZOBRIST_TURN;
+	if (move == -1)
+		return hash;
+	
+	hash ^= zobrist[move][player==PLAYER2];
+	for (j=0; j<8; j++) {
+		if (flipdir[pos = move] & (1<<j)) {
+			for (n=0, pos+=dirs[j]; board[pos]==-player; n++, pos+=dirs[j]);
+			if (n>0 && board[pos]==player) {
+				for (pos-=dirs[j]; board[pos]==-player; pos-=dirs[j]) {
+					flip = zobrist[pos];
+					hash ^= flip[0] ^ flip[1];
+				}
+			}
+		}
+	}
+	return hash;
+}
+
+/** Initialize stability of board. Every flag is cleared before any
+	is computed, since emptyboard() leaves them INVALID, which reads as
+	stable. Pieces can become stable because a neighbor did, so this
+	repeats until nothing changes. */
+void init_stability(int *board) {
+	int i;
+	P1NUMSTABLE(board) = 0;
+	TOTALNUMSTABLE(board) = 0;
+	
+	for (i=0; i<BOARDSIZE; i++) {
+		COLFILLED(board,i) = 0;
+		ROWFILLED(board,i) = 0;
+	}
+	for (i=0; i<NUMDIAGS; i++) {
+		DIAG1FILLED(board,i) = (i<BOARDSIZE-1)?(BOARDSIZE-1-i):(i-BOARDSIZE+1);
+		DIAG2FILLED(board,i) = (i<BOARDSIZE-1)?(BOARDSIZE-1-i):(i-BOARDSIZE+1);
+	}
+	
+	for (i=FIRSTSQ; i<=LASTSQ; i++) {
+		STABLE(board,i) = 0;
+		if (board[i] == PLAYER1 || board[i] == PLAYER2) {
+			INCR_STABILITY(board,i);
+		}
+	}
+
+	while (updatestability(board,NULL));
+}
+
+/** Compute the running totals of the heuristics from scratch. */
+void init_totals(int *board) {
+	int i, j;
+	DISKSQUARE(board) = 0;
+	FRONTIER(board) = 0;
+	PARITY(board) = 0;
+	
+	for (i=FIRSTSQ; i<=LASTSQ; i++) {
+		if (board[i] == INVALID)
+			continue;
+		DISKSQUARE(board) += board[i]*disksquare[i];
+		if (board[i] == EMPTY)
+			PARITY(board) ^= 1 << quadrant[i];
+	}
+	for (i=0; i<NUMINNER; i++) {
+		if (board[inner[i]] == EMPTY)
+			continue;
+		for (j=0; j<8; j++)
+			if (board[inner[i]+dirs[j]] == EMPTY)
+				FRONTIER(board) -= board[inner[i]];
+	}
+}
+
+/** Find legal moves and place them in the "legalmoves" array. 
+	legalmoves[0] contains the number of legal moves, and other
+	elements of the array contain the positions of the moves. */
+void getmoves(int *board, int *legalmoves) {
+	uint8_t moves[MAXMOVES];
+	int i;
+	
+	legalmoves[0] = genmoves(board,moves);
+	for (i=0; i<legalmoves[0]; i++)
+		legalmoves[i+1] = moves[i];
+	
+	/* If no legal moves, say there is one legal move (-1) 
+		which will be interpreted as a skipped turn. */
+	if (legalmoves[0] == 0) {
+		legalmoves[0] = 1;
+		legalmoves[1] = -1;
+	}	
+}
+
+/** Find legal moves, ordered from best to worst as in positions[], 
+	and store them in moves[] unless it's NULL. Returns the number 
+	of legal moves (0 if the player has to pass). */
+int genmoves(int *board, uint8_t *moves) {
+	int i, j, pos, count, nummoves=0;
+	int player = TURN(board);
+	
+	for (i=0; i<NUMTILES; i++) {
+		if (board[positions[i]] != EMPTY)
+			continue;
+		
+		for (j=0; j<8; j++) { // Check each direction
+			pos = positions[i];
+			if (flipdir[pos] & (1<<j)) {
+				for (count=0, pos+=dirs[j]; board[pos]==-player; count++, pos+=dirs[j]);
+				if (count!=0 && board[pos]==player) {
+					if (moves)
+						moves[nummoves] = positions[i];
+					nummoves++;
+					break;
+				}
+			}
+		}
+	}
+	return nummoves;
+}
+
+/** Copy the squares of the board, without any of the metadata, into
+	the compact form used by playouts: PLAYER1, PLAYER2 or EMPTY, and
+	OFFBOARD for the placeholder positions. */
+void getsquares(const int *board, int8_t *sq) {
+	int i;
+	for (i=0; i<BOARDEND; i++)
+		sq[i] = board[i] == INVALID ? OFFBOARD : board[i];
+}
+
+/** Play a move on squares from getsquares(), flipping pieces but
+	keeping no metadata, stability or undo information. Returns the
+	number of pieces flipped; 0 means the move was illegal and nothing
+	changed. */
+int flipsquares(int8_t *sq, int move, int player) {
+	int j, pos, count = 0;
+
+	for (j=0; j<8; j++) {
+		if (flipdir[move] & (1<<j)) {
+			for (pos=move+dirs[j]; sq[pos]==-player; pos+=dirs[j]);
+			if (sq[pos]==player)
+				for (pos-=dirs[j]; pos!=move; pos-=dirs[j], count++)
+					sq[pos] = player;
+		}
+	}
+	if (count)
+		sq[move] = player;
+	return count;
+}
+
+/** Initialize the board to be empty. */
+void emptyboard(int *board) {
+	int x, y;
+	
+	for (x=0; x<ARRSIZE; x++)
+		board[x] = INVALID;
+	
+	for (x=0; x<BOARDSIZE; x++)
+		for (y=0; y<BOARDSIZE; y++)
+			board[GETPOS(x,y)] = EMPTY;
+			
+	TURN(board) = PLAYER1;
+	P1PIECES(board) = 0;
+	ACTIVEPIECES(board) = 0;
+	JUSTPLAYED(board) = -1;
+	init_totals(board);
+}
+
+/** Initialize board to the default start position. */
+void defaultboard(int *board) {
+	int c = BOARDSIZE/2;
+	
+	emptyboard(board);
+	
+	board[GETPOS(c,c-1)] = board[GETPOS(c-1,c)] = PLAYER1;
+	board[GETPOS(c-1,c-1)] = board[GETPOS(c,c)] = PLAYER2;
+	
+	P1PIECES(board) = 2;
+	ACTIVEPIECES(board) = 4;
+	init_stability(board);
+	init_totals(board);
+}
+
+/** Parse a board from a string. The format is as follows:
+	- NUMTILES characters each with values of either 0, 1, or 2 
+		corresponding to EMPTY, PLAYER1, and PLAYER2 respectively.
+		The 1st character corresponds to position A1 and the last
+		character to the opposite corner (H8 on an 8x8 board).
+	- 1 character (0, 1, or 2) corresponding to whose turn it is.
+	- Characters that are not 0, 1, or 2 are ignored.
+	Returns the number of characters read, or -1 if the string 
+	is formatted incorrectly.
+*/
+int parseboard(const char *str, int *board) {
+	const char *p = str;
+	int i, j;
+	
+	emptyboard(board);
+	
+	for (j=0; j<BOARDSIZE; j++) {
+		for (i=0; i<BOARDSIZE; p++) {
+			switch(*p) {
+			case '\0':
+				return -1;
+			case '0':
+				board[GETPOS(i++,j)] = EMPTY;
+				break;
+			case '1':
+				board[GETPOS(i++,j)] = PLAYER1;
+				P1PIECES(board)++;
+				ACTIVEPIECES(board)++;
+				break;
+			case '2':
+				board[GETPOS(i++,j)] = PLAYER2;
+				ACTIVEPIECES(board)++;
+				break;
+			}
+		}
+	}
+	for (;; p++) {
+		if (*p == '\0')
+			return -1;
+		if (*p == '0' || *p == '1')
+			break;
+		if (*p == '2') {
+			TURN(board) = PLAYER2;
+			break;
+		}
+	}
+	
+	init_stability(board);
+	init_totals(board);
+	return p+1-str;
+}
+
+/** Load board from file. See parseboard() for the format. */
+int loadboard(char *fname, int *board) {
+	char buf[4096];
+	size_t len;
+	FILE *fp;
+	
+	if ((fp = fopen(fname,"r")) == NULL) {
+		fprintf(stderr,"Error: Could not open file \"%s\" for reading: %s\n",fname,strerror(errno));
+		return -1;
+	}
+	len = fread(buf,1,sizeof buf-1,fp);
+	buf[len] = '\0';
+	fclose(fp);
+	
+	if (parseboard(buf,board) < 0) {
+		fprintf(stderr,"Error: File \"%s\" is formatted incorrectly.\n",fname);
+		return -1;
+	}
+	return 0;
+}
+
+/** Convert a move in the form "f5" (or "pass") to a position.
+	Returns 0 if the string isn't a move. */
+int strtomove(const char *str) {
+	int y;
+	
+	if (strcmp(str,"pass") == 0 || strcmp(str,"PA") == 0)
+		return -1;
+	if (tolower(str[0]) >= 'a' && tolower(str[0]) < 'a'+BOARDSIZE && isdigit(str[1])) {
+		y = atoi(str+1);
+		if (y >= 1 && y <= BOARDSIZE)
+			return GETPOS(tolower(str[0])-'a',y-1);
+	}
+	return 0;
+}
+
+/** Write the board in the format read by parseboard(): one character
+	per square ('1', '2' or '0'), then the player to move. str must
+	hold at least NUMTILES+2 characters. */
+char *boardtostr(int *board, char *str) {
+	char *p = str;
+	int x, y;
+	for (y=0; y<BOARDSIZE; y++)
+		for (x=0; x<BOARDSIZE; x++)
+			*p++ = "201"[board[GETPOS(x,y)]+1];
+	*p++ = TURN(board) == PLAYER1 ? '1' : '2';
+	*p = '\0';
+	return str;
+}
+
+/** Write a position as a move like "f5" ("j10" on a 10x10 board). */
+char *movetostr(int move, char *str) {
+	if (move == -1)
+		strcpy(str,"pass");
+	else
+		sprintf(str,"%c%d",'a'+GETX(move),1+GETY(move));
+	return str;
+}
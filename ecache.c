@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "othello.h"
+#include "ecache.h"
+#include "memory.h"
+
+/* Laid out like the transposition table (see tt.c): buckets of four
+	entries, each holding its packed data and the key xored with it,
+	so threads can share the cache without locking.
+
+	Data layout:  bits  0-7   lower bound + NUMTILES
+	              bits  8-15  upper bound + NUMTILES
+	              bits 16-23  number of empty squares
+	              bit  24     always set, so that no entry is all zeros
+
+	The file written by ec_save() is the magic number followed by the
+	key and data of every entry, all as native-endian 64-bit words. */
+
+#define BUCKETSIZE 4
+/* "ECACHE08" on little-endian machines, ending in the board size */
+#define MAGIC (0x454843414345ULL | (uint64_t)('0'+BOARDSIZE/10) << 48 | (uint64_t)('0'+BOARDSIZE%10) << 56)
+
+struct ecentry {
+	uint64_t check;		/* key ^ data */
+	uint64_t data;
+};
+
+struct ecache {
+	struct ecentry *entries;
+	uint64_t mask;		/* Number of buckets - 1 */
+	int kind;			/* How the entries are backed (memory.h) */
+};
+
+#define DATA_LOWER(d) ((int)((d) & 0xff) - NUMTILES)
+#define DATA_UPPER(d) ((int)(((d)>>8) & 0xff) - NUMTILES)
+#define DATA_EMPTIES(d) ((int)(((d)>>16) & 0xff))
+
+/** Create a cache using at most the given number of bytes. */
+struct ecache *ec_create(size_t bytes) {
+	struct ecache *ec;
+	size_t buckets = 1;
+
+	while (buckets*2*BUCKETSIZE*sizeof(struct ecentry) <= bytes)
+		buckets *= 2;
+
+	if ((ec = malloc(sizeof *ec)) == NULL)
+		return NULL;
+	if ((ec->entries = mem_alloc(buckets*BUCKETSIZE*sizeof *ec->entries, &ec->kind)) == NULL) {
+		free(ec);
+		return NULL;
+	}
+	ec->mask = buckets-1;
+	return ec;
+}
+
+void ec_destroy(struct ecache *ec) {
+	if (ec) {
+		mem_free(ec->entries, (ec->mask+1)*BUCKETSIZE*sizeof *ec->entries);
+		free(ec);
+	}
+}
+
+void ec_clear(struct ecache *ec) {
+	memset(ec->entries, 0, (ec->mask+1)*BUCKETSIZE*sizeof *ec->entries);
+}
+
+/** Bytes used by the entries of the table, at most the size it was
+	created with. If kind isn't NULL it is set to how they are backed
+	(MEM_NORMAL, MEM_HUGETLB or MEM_THP). */
+size_t ec_memory(struct ecache *ec, int *kind) {
+	if (kind)
+		*kind = ec->kind;
+	return (ec->mask+1)*BUCKETSIZE*sizeof *ec->entries;
+}
+
+/** Start loading the bucket of a position into the cache, ahead of
+	a probe or store. */
+void ec_prefetch(struct ecache *ec, uint64_t key) {
+#ifdef __GNUC__
+	__builtin_prefetch(ec->entries + (key & ec->mask)*BUCKETSIZE);
+#else
+	(void)ec;
+	(void)key;
+#endif
+}
+
+/** Look up a position. Returns nonzero and fills in *bounds if found. */
+int ec_probe(struct ecache *ec, uint64_t key, struct ecbounds *bounds) {
+	struct ecentry *bucket = ec->entries + (key & ec->mask)*BUCKETSIZE;
+	uint64_t d;
+	int i;
+
+	for (i=0; i<BUCKETSIZE; i++) {
+		d = bucket[i].data;
+		if ((bucket[i].check ^ d) == key && d) {
+			bounds->lower = DATA_LOWER(d);
+			bounds->upper = DATA_UPPER(d);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/** Add bounds for a position, narrowing those already stored for it.
+	Otherwise replaces the entry with the fewest empty squares, the
+	cheapest to solve again. */
+void ec_store(struct ecache *ec, uint64_t key, int empties, int lower, int upper) {
+	struct ecentry *bucket = ec->entries + (key & ec->mask)*BUCKETSIZE;
+	struct ecentry *replace = bucket;
+	uint64_t d;
+	int i;
+
+	for (i=0; i<BUCKETSIZE; i++) {
+		d = bucket[i].data;
+		if ((bucket[i].check ^ d) == key && d) {
+			replace = &bucket[i];
+			if (DATA_LOWER(d) > lower)
+				lower = DATA_LOWER(d);
+			if (DATA_UPPER(d) < upper)
+				upper = DATA_UPPER(d);
+			break;
+		}
+		if (DATA_EMPTIES(d) < DATA_EMPTIES(replace->data))
+			replace = &bucket[i];
+	}
+
+	d = (uint64_t)(lower+NUMTILES)
+		| (uint64_t)(upper+NUMTILES) << 8
+		| (uint64_t)(empties & 0xff) << 16
+		| (uint64_t)1 << 24;
+	replace->data = d;
+	replace->check = key ^ d;
+}
+
+/** Write every entry to a file. Returns 0, or -1 on error. */
+int ec_save(struct ecache *ec, const char *fname) {
+	FILE *fp;
+	uint64_t i, d, word[2] = {MAGIC, 0};
+	int ok;
+
+	if ((fp = fopen(fname,"wb")) == NULL)
+		return -1;
+	ok = fwrite(word, sizeof *word, 1, fp) == 1;
+	for (i=0; ok && i<(ec->mask+1)*BUCKETSIZE; i++) {
+		if ((d = ec->entries[i].data) == 0)
+			continue;
+		word[0] = ec->entries[i].check ^ d;
+		word[1] = d;
+		ok = fwrite(word, sizeof *word, 2, fp) == 2;
+	}
+	if (fclose(fp) != 0)
+		ok = 0;
+	return ok ? 0 : -1;
+}
+
+/** Add the entries saved in a file to the cache. Returns the number
+	of entries read, or -1 if the file can't be read. */
+int ec_load(struct ecache *ec, const char *fname) {
+	FILE *fp;
+	uint64_t word[2];
+	int n = 0;
+
+	if ((fp = fopen(fname,"rb")) == NULL)
+		return -1;
+	if (fread(word, sizeof *word, 1, fp) != 1 || word[0] != MAGIC) {
+		fclose(fp);
+		return -1;
+	}
+	while (fread(word, sizeof *word, 2, fp) == 2) {
+		ec_store(ec, word[0], DATA_EMPTIES(word[1]), DATA_LOWER(word[1]), DATA_UPPER(word[1]));
+		n++;
+	}
+	fclose(fp);
+	return n;
+}
@@ -0,0 +1,38 @@
+#ifndef ECACHE_H
+#define ECACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Endgame cache: game-theoretic results of solved positions, kept
+	across moves and games. Unlike the transposition table, entries
+	don't depend on search depth or the evaluation function, so they
+	never go stale and can be saved to disk and shared between
+	engines. */
+
+#define EC_DEFAULTSIZE (1<<22)	/* Bytes */
+#define EC_MINEMPTIES 6		/* Positions with fewer empty squares are
+								solved faster than they are looked up */
+#define EC_MAXEMPTIES 24	/* Positions with more are never solved */
+
+/** Bounds on the final disk difference, from the point of view of
+	the side to move. lower == upper is an exact result; bounds that
+	only fix the sign (win/loss/draw) are kept as they are found. */
+struct ecbounds {
+	int lower;
+	int upper;
+};
+
+struct ecache;
+
+struct ecache *ec_create(size_t bytes);
+void ec_destroy(struct ecache *ec);
+void ec_clear(struct ecache *ec);
+size_t ec_memory(struct ecache *ec, int *kind);
+void ec_prefetch(struct ecache *ec, uint64_t key);
+int ec_probe(struct ecache *ec, uint64_t key, struct ecbounds *bounds);
+void ec_store(struct ecache *ec, uint64_t key, int empties, int lower, int upper);
+int ec_save(struct ecache *ec, const char *fname);
+int ec_load(struct ecache *ec, const char *fname);
+
+#endif
@@ -0,0 +1,819 @@
+#include <time.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/time.h>
+#include <pthread.h>
+#include "engine.h"
+#include "mcts.h"
+
+/* The search makes and takes back moves on the engine's own board.
+	Everything it needs per ply lives in this preallocated stack and the
+	triangular principal variation table rather than in negamax()'s
+	frame, so a search only touches the frames and table rows of the
+	plies it reaches: a few kilobytes at the usual depths. */
+struct stackframe {
+	uint8_t moves[MAXMOVES];	/* Legal moves, best first */
+	struct undo undo;			/* Undo record of the move being searched */
+};
+
+/* Row ply of the principal variation table holds the MAXPLY-ply moves
+	a line from that ply can have, and the rows are packed back to back. */
+#define PVROW(ply) ((ply)*MAXPLY - (ply)*((ply)-1)/2)
+#define PVSIZE PVROW(MAXPLY)
+
+struct engine {
+	int board[ARRSIZE];
+	struct searchlimits limits;
+	double starttime;
+	volatile double timelimit;	/* limits.time, until changed by engine_extend() */
+	int endgame;			/* Set once a search has reached terminal nodes */
+	volatile int stop;		/* Set by engine_stop() or when a limit is hit */
+	unsigned long nodes;
+	unsigned long reductions, researches, extensions;
+	struct searchparams params;
+	int depth;				/* Depth of the current iteration */
+	int rootmoves[MAXMOVES];
+	uint64_t hash;			/* Hash of the root position */
+	struct movescore rootscores[MAXMOVES];	/* Analysis scores, best first */
+	struct ttable *tt;
+	int sharedtt;			/* tt was given by engine_settt() */
+	struct ecache *ec;		/* Endgame cache, not owned by the engine */
+	struct mcts *mcts;		/* Searches with this instead if set (ENGINE_MCTS) */
+	size_t budget;			/* Set by engine_setmemory(), or 0 */
+	int nthreads;			/* Of mcts */
+	unsigned long horizon;	/* Leaves scored without reaching the end of the game */
+	unsigned int seed;		/* State of the tie-breaking random generator */
+	int16_t pv[PVSIZE];		/* Principal variations, row ply at PVROW(ply) */
+	int pvlength[MAXPLY];
+	struct stackframe stack[MAXPLY];
+	pthread_t thread;		/* Running the search started by engine_start() */
+	int started;			/* thread hasn't been joined by engine_wait() */
+	searchcallback callback;
+	void *callbackarg;
+	struct searchresult async;	/* Result of engine_start()'s search */
+#ifdef PROFILE
+	struct searchprofile prof;
+#endif
+};
+
+static int negamax(struct engine *e, int d, int ply, uint64_t hash, int alpha, int beta);
+
+#define ETC_MINDEPTH 4	/* Shallower nodes aren't worth probing children for */
+
+// Defaults of struct searchparams
+#define LMR_MINDEPTH 3
+#define LMR_MOVES 3
+#define LMR_REDUCTION 2
+#define EXT_CORNER 1
+#define EXT_PASS 1
+#define EXT_MAX 1
+
+/* Names of the parameters for engine_setparam() */
+static const struct {
+	const char *name;
+	size_t offset;
+	int min, max;
+} paramnames[] = {
+	{ "lmrdepth", offsetof(struct searchparams, lmrdepth), 1, MAXPLY },
+	{ "lmrmoves", offsetof(struct searchparams, lmrmoves), 1, MAXMOVES },
+	{ "lmrreduce", offsetof(struct searchparams, lmrreduce), 0, MAXPLY },
+	{ "cornerext", offsetof(struct searchparams, cornerext), 0, 1 },
+	{ "passext", offsetof(struct searchparams, passext), 0, 1 },
+	{ "maxext", offsetof(struct searchparams, maxext), 0, MAXPLY },
+};
+
+/** Current wall-clock time in seconds */
+static double now(void) {
+	struct timeval tv;
+	gettimeofday(&tv,NULL);
+	return tv.tv_sec+(tv.tv_usec/1000000.0);
+}
+
+/** xorshift generator used to break ties between equal moves. It
+	replaces rand() so that engines don't share any hidden state. */
+static unsigned int nextrand(struct engine *e) {
+	e->seed ^= e->seed << 13;
+	e->seed ^= e->seed >> 17;
+	e->seed ^= e->seed << 5;
+	return e->seed;
+}
+
+struct engine *engine_create(void) {
+	struct engine *e;
+
+	if ((e = calloc(1, sizeof *e)) == NULL)
+		return NULL;
+	if ((e->tt = tt_create(TT_DEFAULTSIZE)) == NULL) {
+		free(e);
+		return NULL;
+	}
+
+	defaultboard(e->board);
+	e->seed = (unsigned int)time(NULL) ^ (unsigned int)(size_t)e;
+	if (e->seed == 0)
+		e->seed = 1;
+	e->params.lmrdepth = LMR_MINDEPTH;
+	e->params.lmrmoves = LMR_MOVES;
+	e->params.lmrreduce = LMR_REDUCTION;
+	e->params.cornerext = EXT_CORNER;
+	e->params.passext = EXT_PASS;
+	e->params.maxext = EXT_MAX;
+	return e;
+}
+
+void engine_destroy(struct engine *e) {
+	if (e->started) {
+		engine_stop(e);
+		pthread_join(e->thread, NULL);
+	}
+	if (!e->sharedtt)
+		tt_destroy(e->tt);
+	mcts_destroy(e->mcts);
+	free(e);
+}
+
+/** Forget everything learned about the previous game. */
+void engine_newgame(struct engine *e) {
+	e->endgame = 0;
+	if (!e->sharedtt)
+		tt_clear(e->tt);
+	if (e->mcts)
+		mcts_newgame(e->mcts);
+}
+
+/** Replace the transposition table and tree with ones for mode that
+	fit in the engine's memory budget: alpha-beta gets a table of all of
+	it, MCTS a tree of all of it but the smallest table, and the table
+	is kept without a budget or when it is shared. Returns 0, or -1 if
+	they can't be allocated, in which case nothing changes. */
+static int allocate(struct engine *e, size_t budget, int mode, int nthreads) {
+	struct ttable *tt = NULL;
+	struct mcts *m = NULL;
+	size_t bytes = MCTS_DEFAULTSIZE;
+
+	if (budget) {
+		if (budget < sizeof *e + TT_MINSIZE)
+			return -1;
+		bytes = budget - sizeof *e;
+		if (!e->sharedtt) {
+			if ((tt = tt_create(mode == ENGINE_MCTS ? TT_MINSIZE : bytes)) == NULL)
+				return -1;
+			bytes -= tt_memory(tt, NULL);
+		}
+	}
+	if (mode == ENGINE_MCTS && (m = mcts_create(nthreads, bytes)) == NULL) {
+		tt_destroy(tt);
+		return -1;
+	}
+	if (tt) {
+		tt_destroy(e->tt);
+		e->tt = tt;
+	}
+	if (m)
+		mcts_setseed(m, e->seed);
+	mcts_destroy(e->mcts);
+	e->mcts = m;
+	e->budget = budget;
+	e->nthreads = nthreads;
+	return 0;
+}
+
+/** Choose how the engine searches: ENGINE_ALPHABETA, or ENGINE_MCTS
+	with the given number of threads searching one tree. Within a budget
+	set by engine_setmemory() the memory moves between the transposition
+	table and the tree. Returns 0, or -1 if they couldn't be allocated,
+	in which case nothing changes. */
+int engine_setmode(struct engine *e, int mode, int nthreads) {
+	if (mode == ENGINE_ALPHABETA && !e->mcts)
+		return 0;
+	return allocate(e, e->budget, mode, nthreads);
+}
+
+int engine_mode(struct engine *e) {
+	return e->mcts ? ENGINE_MCTS : ENGINE_ALPHABETA;
+}
+
+void engine_setposition(struct engine *e, const int *board) {
+	memcpy(e->board, board, sizeof e->board);
+}
+
+void engine_setlimits(struct engine *e, const struct searchlimits *limits) {
+	e->limits = *limits;
+}
+
+/** Seed the generator that breaks ties between equally good moves.
+	With the same seed, limits other than time, and position, searches
+	are reproducible. */
+void engine_setseed(struct engine *e, unsigned int seed) {
+	e->seed = seed ? seed : 1;
+	if (e->mcts)
+		mcts_setseed(e->mcts, e->seed);
+}
+
+/** Set one of the search parameters (see struct searchparams) by
+	name. Returns 0, or -1 if there is no such parameter or the value
+	is out of range, in which case nothing changes. */
+int engine_setparam(struct engine *e, const char *name, int value) {
+	size_t i;
+
+	for (i=0; i<sizeof paramnames/sizeof *paramnames; i++) {
+		if (strcmp(name, paramnames[i].name) == 0) {
+			if (value < paramnames[i].min || value > paramnames[i].max)
+				return -1;
+			*(int *)((char *)&e->params + paramnames[i].offset) = value;
+			return 0;
+		}
+	}
+	return -1;
+}
+
+const struct searchparams *engine_params(struct engine *e) {
+	return &e->params;
+}
+
+#ifdef PROFILE
+/** Profile of the last search, one entry per iteration including
+	an unfinished last one. */
+const struct searchprofile *engine_profile(struct engine *e) {
+	return &e->prof;
+}
+#endif
+
+/** Use an endgame cache for solved positions. It is kept across
+	engine_newgame() and may be shared by several engines; pass NULL
+	to stop using one. */
+void engine_setecache(struct engine *e, struct ecache *ec) {
+	e->ec = ec;
+}
+
+/** Search with a transposition table shared with other engines
+	instead of the engine's own, which is freed. The caller keeps
+	ownership of tt. Nothing clears a shared table: positions searched
+	by other engines only meet in it where they transpose. The engine
+	doesn't age it either; the caller calls tt_newsearch() when its
+	entries should be replaced first. */
+void engine_settt(struct engine *e, struct ttable *tt) {
+	if (!e->sharedtt)
+		tt_destroy(e->tt);
+	e->tt = tt;
+	e->sharedtt = 1;
+}
+
+/** Limit the memory the engine uses, its transposition table, MCTS
+	tree and search state together, to the given number of bytes. The
+	table and tree are replaced by empty ones of the largest size that
+	fits (see allocate()). Returns 0, or -1 if that isn't possible (too
+	little memory, or a table shared with engine_settt()), in which case
+	nothing changes. */
+int engine_setmemory(struct engine *e, size_t bytes) {
+	if (e->sharedtt || bytes == 0)
+		return -1;
+	return allocate(e, bytes, engine_mode(e), e->nthreads);
+}
+
+/** Bytes used by the engine, not counting a shared table or the
+	endgame cache. If kind isn't NULL it is set to how the table, or in
+	ENGINE_MCTS mode the tree, is backed (see memory.h). */
+size_t engine_memory(struct engine *e, int *kind) {
+	size_t tt = tt_memory(e->tt, kind);
+	return sizeof *e + (e->sharedtt ? 0 : tt) + (e->mcts ? mcts_memory(e->mcts, kind) : 0);
+}
+
+/** Ask a running search to return as soon as possible. Safe to call
+	from another thread; the search returns its last completed result. */
+void engine_stop(struct engine *e) {
+	e->stop = 1;
+	if (e->mcts)
+		mcts_stop(e->mcts);
+}
+
+/** Give the running search the given number of seconds more than its
+	time limit, or with seconds <= 0 take the limit away, so that it only
+	ends at its other limits or engine_stop(). Takes effect at once;
+	like engine_stop() it is safe to call from another thread. Does
+	nothing to a search without a time limit, or to the next search. */
+void engine_extend(struct engine *e, double seconds) {
+	if (e->mcts)
+		mcts_extend(e->mcts, seconds);
+	else if (seconds <= 0)
+		e->timelimit = 0;
+	else if (e->timelimit > 0)
+		e->timelimit += seconds;
+}
+
+/** Check the node and time limits, and whether we've been stopped. */
+static int outoftime(struct engine *e) {
+	if (e->stop)
+		return 1;
+	if (e->limits.nodes && e->nodes >= e->limits.nodes)
+		return e->stop = 1;
+	if (e->timelimit > 0 && now()-e->starttime > e->timelimit)
+		return e->stop = 1;
+	return 0;
+}
+
+/** Prepend move to the principal variation found one ply deeper. */
+static void updatepv(struct engine *e, int ply, int move) {
+	int16_t *pv = e->pv + PVROW(ply), *next = e->pv + PVROW(ply+1);
+	int i;
+	pv[0] = move;
+	for (i=0; i<e->pvlength[ply+1]; i++)
+		pv[i+1] = next[i];
+	e->pvlength[ply] = e->pvlength[ply+1]+1;
+}
+
+/** Copy the principal variation of the root to result. */
+static void getpv(struct engine *e, struct searchresult *result) {
+	int i;
+	result->pvlength = e->pvlength[0];
+	for (i=0; i<e->pvlength[0]; i++)
+		result->pv[i] = e->pv[i];
+}
+
+/** Score of a finished game won by the given number of disks, and back */
+static int gamescore(int diff) {
+	return (diff >= 0) ? END+diff : diff-END;
+}
+
+static int diskdiff(int score) {
+	return (score >= 0) ? score-END : score+END;
+}
+
+/** Move the given move to the front of moves[], keeping 
+	the others in order. */
+static void ordermove(uint8_t *moves, int n, int move) {
+	int i;
+	for (i=0; i<n; i++) {
+		if (moves[i] == move) {
+			for (; i>0; i--)
+				moves[i] = moves[i-1];
+			moves[0] = move;
+			break;
+		}
+	}
+}
+
+/** Search every root move to depth d. Returns the index of the best
+	move (0 if stopped before any move was searched) and its score in
+	*score. */
+static int searchroot(struct engine *e, int d, int *legalmoves, int *score) {
+	struct undo *u = &e->stack[0].undo;
+	int i, val, best = -INF, indexbest = 0, ties = 0;
+	int player = TURN(e->board);
+
+	for (i=1; i<=legalmoves[0]; i++) {
+		PROF_VOID(PROF_MAKEMOVE, makemove(e->board, legalmoves[i], u));  // Apply the move
+
+		/* The window is widened by one so that moves tying with
+			the best one get an exact score rather than a bound. */
+		val = -negamax(e, d-1, 1, hashupdate(e->hash, player, u),
+				-INF, (best == -INF) ? INF : -best+1);
+		PROF_VOID(PROF_UNDOMOVE, undomove(e->board, u));
+		if (e->stop)
+			break;
+
+		if (val>best) {
+			best = val;
+			indexbest = i;
+			ties = 1;
+			updatepv(e, 0, legalmoves[i]);
+		}
+		else if (val == best && nextrand(e) % ++ties == 0) {
+			indexbest = i; // Moves with the same evaluation get chosen randomly
+			updatepv(e, 0, legalmoves[i]);
+		}
+	}
+
+	*score = best;
+	return indexbest;
+}
+
+/** Analysis version of searchroot(). Searches the root moves in the
+	order of the previous iteration, getting exact scores for the best
+	k of them and upper bounds for the rest, which only need to be shown
+	to be worse than the k-th best. Scores are left in e->rootscores[],
+	best first. Returns nonzero unless the search was stopped. */
+static int searchmulti(struct engine *e, int d, int k) {
+	struct undo *u = &e->stack[0].undo;
+	struct movescore *moves = e->rootscores, tmp;
+	int topk[MAXMOVES];
+	int i, j, val, lower, best = -INF, nexact = 0;
+	int n = e->rootmoves[0], player = TURN(e->board);
+
+	for (i=0; i<n; i++) {
+		PROF_VOID(PROF_MAKEMOVE, makemove(e->board, moves[i].move, u));
+
+		lower = (nexact >= k) ? topk[k-1]-1 : -INF;
+		val = -negamax(e, d-1, 1, hashupdate(e->hash, player, u), -INF, -lower);
+		PROF_VOID(PROF_UNDOMOVE, undomove(e->board, u));
+		if (e->stop)
+			return 0;
+
+		moves[i].score = val;
+		moves[i].bound = (val <= lower) ? TT_UPPER : TT_EXACT;
+		if (moves[i].bound == TT_EXACT) {
+			for (j=nexact++; j>0 && topk[j-1]<val; j--)
+				topk[j] = topk[j-1];
+			topk[j] = val;
+		}
+		if (val > best) {
+			best = val;
+			updatepv(e, 0, moves[i].move);
+		}
+	}
+
+	// Sort by score. Upper bounds are all below the k-th exact score.
+	for (i=1; i<n; i++) {
+		tmp = moves[i];
+		for (j=i; j>0 && moves[j-1].score<tmp.score; j--)
+			moves[j] = moves[j-1];
+		moves[j] = tmp;
+	}
+	return 1;
+}
+
+/** Enhanced transposition cutoff: before searching the n moves in
+	e->stack[ply].moves, look up the positions they lead to. If one is
+	already known to be at least beta for us, return its score (and
+	store it for this position); otherwise return -INF. */
+static int etc(struct engine *e, int d, int ply, uint64_t hash, int n, int beta) {
+	struct stackframe *f = &e->stack[ply];
+	int *board = e->board;
+	int i, val, solved, empties = NUMTILES-ACTIVEPIECES(board)-1;
+	uint64_t child;
+	struct ttdata tte;
+	struct ecbounds ecb;
+
+	for (i=0; i<n; i++) {
+		child = hashmove(board, hash, f->moves[i]);
+		val = -INF;
+		solved = 1;
+		if (e->ec && empties >= EC_MINEMPTIES && empties <= EC_MAXEMPTIES
+				&& ec_probe(e->ec, child, &ecb))
+			val = -gamescore(ecb.upper);
+		else if (PROF(PROF_TT, tt_probe(e->tt, child, &tte)) && tte.depth >= d-1
+				&& (tte.flag & ~TT_SOLVED) != TT_LOWER) {
+			val = -tte.score;
+			solved = tte.flag & TT_SOLVED;
+		}
+
+		if (val >= beta) {
+			if (!solved)
+				e->horizon++;
+			e->pvlength[ply+1] = 0;
+			updatepv(e, ply, f->moves[i]);
+			PROF_VOID(PROF_TT, tt_store(e->tt, hash, d, val, TT_LOWER | (solved ? TT_SOLVED : 0), f->moves[i]));
+			return val;
+		}
+	}
+	return -INF;
+}
+
+static int negamax(struct engine *e, int d, int ply, uint64_t hash, int alpha, int beta) {
+	struct stackframe *f = &e->stack[ply];
+	struct searchparams *p = &e->params;
+	int *board = e->board;
+	int i, n, move, val, best, bestmove = 0, alpha0 = alpha, flag, newdepth;
+	int player = TURN(board), empties = NUMTILES-ACTIVEPIECES(board), oppstable;
+	unsigned long horizon;
+	uint64_t child;
+	struct ttdata tte;
+	struct ecbounds ecb;
+
+	e->pvlength[ply] = 0;
+	e->nodes++;
+	if (PROF(PROF_TIMECHECK, outoftime(e)))
+		return 0;
+
+	// Positions solved before, in this game or another one
+	if (e->ec && empties >= EC_MINEMPTIES && empties <= EC_MAXEMPTIES
+			&& ec_probe(e->ec, hash, &ecb)) {
+		if (ecb.lower == ecb.upper || gamescore(ecb.lower) >= beta)
+			return gamescore(ecb.lower);
+		if (gamescore(ecb.upper) <= alpha)
+			return gamescore(ecb.upper);
+	}
+
+	horizon = e->horizon;
+	tte.move = 0;
+	if (d > 0 && PROF(PROF_TT, tt_probe(e->tt, hash, &tte)) && tte.depth >= d) {
+		flag = tte.flag & ~TT_SOLVED;
+		if (flag == TT_EXACT
+				|| (flag == TT_LOWER && tte.score >= beta)
+				|| (flag == TT_UPPER && tte.score <= alpha)) {
+			if (!(tte.flag & TT_SOLVED))
+				e->horizon++;
+			return tte.score;
+		}
+	}
+
+	/* Stability cutoff: the opponent's stable pieces will still be
+		theirs at the end, which bounds how well this position can end. */
+	oppstable = (player == PLAYER1) ? TOTALNUMSTABLE(board)-P1NUMSTABLE(board) : P1NUMSTABLE(board);
+	if ((val = gamescore(NUMTILES-2*oppstable)) <= alpha)
+		return val;
+
+	n = PROF(PROF_GENMOVES, genmoves(board, f->moves));
+	if (n == 0 && PROF(PROF_OPPSKIP, oppskipcheck(board))) { // End of the game
+		if ((val = player*h_diskdiff(board)) >= 0)
+			return END+val;
+		else
+			return val-END;
+	}
+	if (d == 0 || ply == MAXPLY-1) { // Reached depth cutoff
+		e->horizon++;
+		if (e->endgame)
+			return player*PROF(PROF_EVALUATION, h_diskdiff(board));
+		// The heuristics score for PLAYER1, so the window is turned around for PLAYER2
+		return player*PROF(PROF_EVALUATION, (player == PLAYER1) ? lazyevaluation(board, n, alpha, beta)
+				: lazyevaluation(board, n, -beta, -alpha));
+	}
+
+	if (d >= ETC_MINDEPTH && (val = etc(e, d, ply, hash, n, beta)) >= beta)
+		return val;
+
+	if (tte.move > 0)
+		PROF_VOID(PROF_ORDERING, ordermove(f->moves, n, tte.move)); // Best move from an earlier search goes first
+
+	best = -INF;
+	for (i=0; i<n || (i==0 && n==0); i++) {
+		move = n ? f->moves[i] : -1; // With no legal moves, pass
+		if (d > 1) { // The child will probe the table: start loading its entry now
+			child = hashmove(board, hash, move);
+			tt_prefetch(e->tt, child);
+		}
+		PROF_VOID(PROF_MAKEMOVE, makemove(board, move, &f->undo));  // Apply the move
+		if (d <= 1)
+			child = hashupdate(hash, player, &f->undo);
+
+		/* A forced pass doesn't use up depth, so that a search as deep as
+			the number of empty squares always reaches the end of the game.
+			The endgame relies on that, whatever the parameters say. */
+		newdepth = d-1;
+		if (!n && (p->passext || e->endgame)) {
+			newdepth = d;
+			e->extensions++;
+		}
+		else if (ISCORNER(move) && p->cornerext && !e->endgame && ply+d < e->depth+p->maxext) {
+			newdepth = d;
+			e->extensions++;
+		}
+
+		/* Late moves only have to be shown to be no better than alpha,
+			at reduced depth. Lines that could still reach the end of the
+			game (d >= empties) are never reduced. */
+		if (i >= p->lmrmoves && d >= p->lmrdepth && p->lmrreduce && newdepth < d
+				&& d < empties && !e->endgame && !ISCORNER(move)) {
+			e->reductions++;
+			val = -negamax(e, newdepth > p->lmrreduce ? newdepth-p->lmrreduce : 0,
+					ply+1, child, -alpha-1, -alpha);
+			if (val > alpha && !e->stop) {
+				e->researches++;
+				val = -negamax(e, newdepth, ply+1, child, -beta, -alpha);
+			}
+		}
+		else
+			val = -negamax(e, newdepth, ply+1, child, -beta, -alpha);
+		PROF_VOID(PROF_UNDOMOVE, undomove(board, &f->undo));
+		if (e->stop)
+			return 0;
+
+		if (val>best) {
+			best = val;
+			bestmove = move;
+			updatepv(e, ply, move);
+		}
+		if (best>=beta)
+			break;
+		if (best>alpha)
+			alpha = best;
+	}
+
+	flag = (best<=alpha0) ? TT_UPPER : (best>=beta) ? TT_LOWER : TT_EXACT;
+	if (e->horizon == horizon) { // Every line was played out to the end
+		if (e->ec && empties >= EC_MINEMPTIES && empties <= EC_MAXEMPTIES)
+			ec_store(e->ec, hash, empties, (flag == TT_UPPER) ? -NUMTILES : diskdiff(best),
+					(flag == TT_LOWER) ? NUMTILES : diskdiff(best));
+		flag |= TT_SOLVED;
+	}
+	PROF_VOID(PROF_TT, tt_store(e->tt, hash, d, best, flag, bestmove));
+	return best;
+}
+
+/** Start a new search of the current position. The search itself
+	is carried out one iteration at a time by engine_iterate(). */
+void engine_begin(struct engine *e, struct searchresult *result) {
+	int i;
+
+	if (e->mcts) {
+		e->starttime = now();
+		mcts_begin(e->mcts, e->board, &e->limits, result);
+		return;
+	}
+	e->starttime = now();
+	e->timelimit = e->limits.time;
+	e->nodes = 0;
+	e->reductions = e->researches = e->extensions = 0;
+	e->stop = 0;
+	e->depth = 0;
+	e->hash = hashboard(e->board);
+	if (!e->sharedtt)	// A shared table is aged by its owner
+		tt_newsearch(e->tt);
+#ifdef PROFILE
+	memset(&e->prof, 0, sizeof e->prof);
+#endif
+
+	memset(result, 0, sizeof *result);
+	getmoves(e->board,e->rootmoves);
+	for (i=0; i<e->rootmoves[0]; i++) {
+		e->rootscores[i].move = e->rootmoves[i+1];
+		e->rootscores[i].score = 0;
+		e->rootscores[i].bound = TT_UPPER;
+	}
+	result->movenum = 1;
+	result->move = result->pv[0] = e->rootmoves[1];
+	result->pvlength = 1;
+}
+
+/** Run the next iteration of iterative deepening and update *result.
+	Returns nonzero if the search could be continued with another call. */
+int engine_iterate(struct engine *e, struct searchresult *result) {
+	int *legalmoves = e->rootmoves;
+	int depth, movenum, score;
+	unsigned long horizon = e->horizon;
+#ifdef PROFILE
+	uint64_t ticks;
+#endif
+
+	if (e->mcts)
+		return mcts_iterate(e->mcts, result);
+	// Not evaluating the game tree if there is only one legal move
+	if ((legalmoves[0] <= 1 && !e->limits.multipv) || result->endgame || e->depth+1 >= MAXPLY)
+		return 0;
+	depth = ++e->depth;
+	if (e->limits.depth && depth > e->limits.depth)
+		return 0;
+
+#ifdef PROFILE
+	e->prof.iter[e->prof.numiters].depth = depth;
+	e->prof.iter[e->prof.numiters].start = now();
+	e->prof.iter[e->prof.numiters].nodes = e->nodes;
+	prof_current = &e->prof.iter[e->prof.numiters].phases;
+	ticks = prof_ticks();
+#endif
+
+	if (e->limits.multipv) {
+		movenum = 0;
+		score = -INF;	// Only used if searchmulti() completes
+		if (searchmulti(e, depth, e->limits.multipv)) {
+			for (movenum=1; legalmoves[movenum]!=e->rootscores[0].move; movenum++);
+			score = e->rootscores[0].score;
+			result->nummoves = legalmoves[0];
+			memcpy(result->moves, e->rootscores, legalmoves[0] * sizeof *result->moves);
+		}
+	}
+	else
+		movenum = searchroot(e, depth, legalmoves, &score);
+
+#ifdef PROFILE
+	prof_current = NULL;
+	ticks = prof_ticks()-ticks;
+	e->prof.iter[e->prof.numiters].end = now();
+	e->prof.iter[e->prof.numiters].nodes = e->nodes - e->prof.iter[e->prof.numiters].nodes;
+	e->prof.iter[e->prof.numiters].ticks = ticks;
+	prof_merge(&e->prof.total, &e->prof.iter[e->prof.numiters].phases);
+	e->prof.ticks += ticks;
+	e->prof.numiters++;
+#endif
+
+	result->nodes = e->nodes;
+	result->reductions = e->reductions;
+	result->researches = e->researches;
+	result->extensions = e->extensions;
+	result->time = now()-e->starttime;
+
+	if (e->stop) { // Out of time, use movenum from previous iteration
+		if (result->depth == 0 && movenum > 0) {
+			result->movenum = movenum;
+			result->move = result->pv[0] = legalmoves[movenum];
+		}
+		return 0;
+	}
+
+	result->movenum = movenum;
+	result->move = legalmoves[movenum];
+	result->score = score;
+	result->depth = depth;
+	getpv(e, result);
+
+	/* Reached the end of the game on every line: the scores are exact,
+		or bounds that don't depend on evaluation() either. */
+	if (e->horizon == horizon) {
+		if (!e->endgame && !e->sharedtt)
+			tt_clear(e->tt); // Scores based on evaluation() no longer apply
+		e->endgame = 1;
+		result->endgame = 1;
+		return 0;
+	}
+	return 1;
+}
+
+/** Solve the position to the end of the game, only as precisely as
+	the window of final disk differences (alpha, beta) requires. Fills
+	in *result like engine_search() and returns TT_EXACT if result->score
+	is the exact result, TT_UPPER if the result is only known to be at
+	most that score (which is at most alpha), TT_LOWER if at least it
+	(at least beta), or -1 if the search was stopped. Always uses
+	alpha-beta, even with ENGINE_MCTS. */
+int engine_solve(struct engine *e, int alpha, int beta, struct searchresult *result) {
+	struct mcts *m = e->mcts;
+	int val, lower = gamescore(alpha), upper = gamescore(beta);
+
+	e->mcts = NULL;
+	engine_begin(e, result);
+	e->mcts = m;
+	if (!e->endgame && !e->sharedtt)
+		tt_clear(e->tt);	// Scores based on evaluation() would be wrong here
+	e->endgame = 1;
+
+	// Passes don't use up depth, so this many plies reach the end of every line
+	e->depth = NUMTILES-ACTIVEPIECES(e->board);
+	val = negamax(e, e->depth, 0, e->hash, lower, upper);
+	result->nodes = e->nodes;
+	result->reductions = e->reductions;
+	result->researches = e->researches;
+	result->extensions = e->extensions;
+	result->time = now()-e->starttime;
+	if (e->stop)
+		return -1;
+
+	result->score = val;
+	result->depth = e->depth;
+	result->endgame = 1;
+	if (e->pvlength[0] > 0) {
+		getpv(e, result);
+		result->move = result->pv[0];
+		for (result->movenum=1; result->movenum<e->rootmoves[0]
+				&& e->rootmoves[result->movenum]!=result->move; result->movenum++);
+	}
+	return (val <= lower) ? TT_UPPER : (val >= upper) ? TT_LOWER : TT_EXACT;
+}
+
+/** Totals of a search that has run its last iteration. */
+static void finish(struct engine *e, struct searchresult *result) {
+	if (!e->mcts)
+		result->nodes = e->nodes;
+	result->time = now()-e->starttime;
+}
+
+/** Iterative deepening with negamax and alpha-beta pruning, or the
+	iterations of MCTS with ENGINE_MCTS. Stores the outcome in *result
+	and returns the index of the chosen move. */
+int engine_search(struct engine *e, struct searchresult *result) {
+	engine_begin(e, result);
+	while (engine_iterate(e, result));
+	finish(e, result);
+	return result->movenum;
+}
+
+static void *searchthread(void *arg) {
+	struct engine *e = arg;
+
+	while (engine_iterate(e, &e->async))
+		if (e->callback)
+			e->callback(&e->async, 0, e->callbackarg);
+	finish(e, &e->async);
+	if (e->callback)
+		e->callback(&e->async, 1, e->callbackarg);
+	return NULL;
+}
+
+/** Start engine_search() of the current position on a thread of its
+	own and return at once. callback, if not NULL, is called from that
+	thread as the search progresses; meanwhile the search can be cut
+	short with engine_stop() or given more time with engine_extend().
+	Nothing else may be done with the engine until engine_wait().
+	Returns 0, or -1 if the thread couldn't be started. */
+int engine_start(struct engine *e, searchcallback callback, void *arg) {
+	if (e->started)
+		return -1;
+	e->callback = callback;
+	e->callbackarg = arg;
+	engine_begin(e, &e->async);
+	if (pthread_create(&e->thread, NULL, searchthread, e) != 0)
+		return -1;
+	e->started = 1;
+	return 0;
+}
+
+/** Wait for the search started by engine_start() to end, store its
+	outcome in *result and return the index of the chosen move. */
+int engine_wait(struct engine *e, struct searchresult *result) {
+	if (!e->started)
+		return 0;
+	pthread_join(e->thread, NULL);
+	e->started = 0;
+	*result = e->async;
+	return result->movenum;
+}
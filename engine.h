@@ -0,0 +1,122 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include "othello.h"
+#include "tt.h"
+#include "ecache.h"
+#include "profile.h"
+#include "memory.h"
+
+/* Embeddable search engine. Every engine instance owns its own
+	position, limits and search state, so any number of them can
+	search concurrently in one process (one thread per instance). */
+
+#define MAXPLY 128
+
+// Search algorithms for engine_setmode()
+#define ENGINE_ALPHABETA 0
+#define ENGINE_MCTS 1		/* Monte Carlo tree search, see mcts.c */
+
+/** Limits for a single search. A value of 0 means "no limit". */
+struct searchlimits {
+	int depth;				/* Maximum iterative-deepening depth */
+	double time;			/* Wall-clock time limit in seconds */
+	unsigned long nodes;	/* Maximum number of nodes searched */
+	int multipv;			/* If nonzero, analyse: score every root move,
+								exactly for the best multipv of them */
+};
+
+/** Selective search, tunable at runtime with engine_setparam(). A
+	move is reduced when it comes late in the ordering of a deep enough
+	node: it is searched lmrreduce plies shallower with a null window,
+	and searched again at full depth if it still beats alpha. Moves to
+	corners are extended by a ply instead. Neither applies once a line
+	can reach the end of the game, so solved scores stay exact. */
+struct searchparams {
+	int lmrdepth;			/* Reduce only with at least this depth left */
+	int lmrmoves;			/* Moves searched in full before reducing */
+	int lmrreduce;			/* Plies taken off a late move, 0 to disable */
+	int cornerext;			/* Extend moves to corners */
+	int passext;			/* A forced pass doesn't use up depth */
+	int maxext;				/* Plies a line may go beyond the iteration depth */
+};
+
+/** Score of one root move in an analysis (multipv) search. */
+struct movescore {
+	int move;
+	int score;
+	int bound;		/* TT_EXACT, or TT_UPPER if score is an upper bound */
+};
+
+/** Outcome of engine_search(). The score is from the point of
+	view of the side to move; scores beyond NEAREND are exact game
+	results (END plus the final disk difference). With ENGINE_MCTS the
+	nodes are playouts and the score is the expected result in
+	thousandths (see mcts.c). */
+struct searchresult {
+	int movenum;			/* Index of the move in the getmoves() array */
+	int move;				/* Position of the move, or -1 for a pass */
+	int score;
+	int depth;				/* Deepest fully completed iteration */
+	int endgame;			/* Search reached the end of the game tree */
+	int pv[MAXPLY];			/* Principal variation, starting with move */
+	int pvlength;
+	unsigned long nodes;
+	unsigned long reductions;	/* Moves searched at reduced depth, */
+	unsigned long researches;	/* of which searched again at full depth */
+	unsigned long extensions;	/* Moves searched a ply deeper */
+	double time;			/* Seconds elapsed */
+	struct movescore moves[MAXMOVES];	/* Analysis only, best first */
+	int nummoves;
+};
+
+#ifdef PROFILE
+/** Where the time of the last search went (built with -DPROFILE). */
+struct searchprofile {
+	struct profile total;
+	uint64_t ticks;			/* Ticks of all iterations */
+	int numiters;
+	struct {
+		int depth;
+		double start, end;	/* Seconds since the epoch */
+		unsigned long nodes;
+		uint64_t ticks;
+		struct profile phases;
+	} iter[MAXPLY];
+};
+#endif
+
+/** Called from the thread of engine_start() with the result so far
+	after every completed iteration (done 0), and once more with the
+	final result when the search is over (done 1). */
+typedef void (*searchcallback)(const struct searchresult *result, int done, void *arg);
+
+struct engine;
+
+struct engine *engine_create(void);
+void engine_destroy(struct engine *e);
+void engine_newgame(struct engine *e);
+int engine_setmode(struct engine *e, int mode, int nthreads);
+int engine_mode(struct engine *e);
+void engine_setposition(struct engine *e, const int *board);
+void engine_setlimits(struct engine *e, const struct searchlimits *limits);
+int engine_search(struct engine *e, struct searchresult *result);
+void engine_begin(struct engine *e, struct searchresult *result);
+int engine_iterate(struct engine *e, struct searchresult *result);
+int engine_solve(struct engine *e, int alpha, int beta, struct searchresult *result);
+int engine_start(struct engine *e, searchcallback callback, void *arg);
+int engine_wait(struct engine *e, struct searchresult *result);
+void engine_stop(struct engine *e);
+void engine_extend(struct engine *e, double seconds);
+void engine_setecache(struct engine *e, struct ecache *ec);
+void engine_settt(struct engine *e, struct ttable *tt);
+int engine_setmemory(struct engine *e, size_t bytes);
+size_t engine_memory(struct engine *e, int *kind);
+void engine_setseed(struct engine *e, unsigned int seed);
+int engine_setparam(struct engine *e, const char *name, int value);
+const struct searchparams *engine_params(struct engine *e);
+#ifdef PROFILE
+const struct searchprofile *engine_profile(struct engine *e);
+#endif
+
+#endif
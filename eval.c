@@ -0,0 +1,258 @@
+#include <stddef.h>
+#include "othello.h"
+#include "tables.h"
+
+/* The fixed value of each square, disksquare[], and the quadrant of
+	each square, quadrant[], are in tables.h (see gentables.c). */
+
+/** Evaluation function with different weights for various stages 
+	of the game. This and all heuristics are from PLAYER1's point of view. */
+#define MIDGAME (NUMTILES*7/16)
+#define ENDGAME (NUMTILES*3/4)
+int evaluation(int *board) {
+	return lazyevaluation(board, -1, -INF, INF);
+}
+
+/** Bound on how far the opponent's part of h_mobility() can move the
+	score, in units of the term: it is -20 when that side has at most
+	one move, or the number of its moves, which are all empty squares. */
+static int oppmobilitybound(int *board) {
+	int empty = NUMTILES-ACTIVEPIECES(board);
+	return (empty > 20) ? empty : 20;
+}
+
+/** Mobility of the side to move, which has count legal moves,
+	as it counts in h_mobility(). */
+static int movermobility(int *board, int count) {
+	return (count > 1) ? TURN(board)*count : -TURN(board)*20;
+}
+
+/** The other side's part of h_mobility(). */
+static int oppmobility(int *board) {
+	int val;
+	TURN(board) = -TURN(board);
+	val = movermobility(board, genmoves(board,NULL));
+	TURN(board) = -TURN(board);
+	return val;
+}
+
+/** Version of evaluation() for a search that only needs to know the
+	score if it is between lower and upper. nmoves is the number of
+	legal moves of the side to move if the caller knows it, or -1. The
+	cheap terms are added up first; when they are so far outside the
+	window that the opponent's mobility can't bring the score back into
+	it, that is skipped and the nearest score it could lead to is
+	returned, which is still outside the window. Otherwise returns
+	evaluation(). */
+int lazyevaluation(int *board, int nmoves, int lower, int upper) {
+	int val, margin;
+	
+	if (nmoves < 0 && ACTIVEPIECES(board) < ENDGAME)
+		nmoves = genmoves(board,NULL);
+	if (ACTIVEPIECES(board) < MIDGAME) {
+		val = 	//-h_diskdiff(board)/2
+				h_disksquare(board)
+				+15*movermobility(board,nmoves)
+				+10*h_edges(board)
+				//+2*h_topology(board)
+				+h_parity(board)
+				+30*h_stability(board)
+				+h_pmobility(board);
+				//+20*h_cornerstability(board);
+		margin = 15*oppmobilitybound(board);
+		if (val-margin >= upper || val+margin <= lower)
+			return (val-margin >= upper) ? val-margin : val+margin;
+		return val+15*oppmobility(board);
+	}
+	else if (ACTIVEPIECES(board) < ENDGAME) {
+		val =	// h_disksquare(board)/2
+				+8*movermobility(board,nmoves)
+				//+2*h_pmobility(board)
+				+5*h_edges(board)
+				+h_parity(board)
+				+30*h_stability(board);
+				//+20*h_cornerstability(board);
+		margin = 8*oppmobilitybound(board);
+		if (val-margin >= upper || val+margin <= lower)
+			return (val-margin >= upper) ? val-margin : val+margin;
+		return val+8*oppmobility(board);
+	}
+	else {
+		return	h_diskdiff(board);
+	}
+}
+
+/** Return the disk difference */
+int h_diskdiff(int *board) {
+	return 2*P1PIECES(board)-ACTIVEPIECES(board);
+}
+
+/** Evaluate a few patterns along an edge, given as its squares in
+	order, scoring the runs of three squares that start on each of its
+	first nruns squares. */
+static int edgepatterns(int *board, const uint8_t *edge, int nruns) {
+	int i, val=0;
+	int b = board[edge[1]], c = board[edge[2]], d = board[edge[BOARDSIZE/2-1]];
+	int e = board[edge[BOARDSIZE/2]], f = board[edge[BOARDSIZE-3]], g = board[edge[BOARDSIZE-2]];
+	
+	for (i=0; i<nruns; i++) {
+		if (board[edge[i]]==board[edge[i+2]]) {
+			if (board[edge[i+1]] == board[edge[i]])
+				val += board[edge[i]];
+			else
+				val -= board[edge[i]];
+		}
+	}
+	
+	if (c == f && d == e) {
+		if (d == EMPTY)
+			val += c;
+		else if (d == f) {
+			val += 2*c;
+			if (b == g && b == c)
+				val += 3*c;
+		}
+	}
+	return val;
+}
+
+/** Evaluate a few edge patterns. The west and east edges leave out 
+	the run of three squares that ends in the bottom corner. */
+int h_edges(int *board) {
+	return edgepatterns(board, edges[0], BOARDSIZE-2)	// North
+		+ edgepatterns(board, edges[1], BOARDSIZE-2)	// South
+		+ edgepatterns(board, edges[2], BOARDSIZE-3)	// West
+		+ edgepatterns(board, edges[3], BOARDSIZE-3);	// East
+}
+
+/** Evaluate the topology of the board. Based on Itamar Faybish's 
+	"Thesis on Genetic Algorithm applied to Othello" and also
+	incorporates an estimation of parity based on quadrants. 	*/
+int h_topology(int *board) {
+	int i, count1[5]={0}, count2[5]={0};
+	int total1, total2, val=0;
+	for (i=FIRSTSQ; i<=LASTSQ; i++) {
+		if (board[i] == PLAYER1)
+			count1[quadrant[i]]++;
+		else if (board[i] == PLAYER2)
+			count2[quadrant[i]]++;
+	}
+	total1 = count1[0]+count1[1]+count1[2]+count1[3];
+	total2 = count2[0]+count2[1]+count2[2]+count2[3];
+	
+	for (i=0; i<4; i++) {
+		if (total1-count1[i]!=0)
+			val += count1[i]/(total1-count1[i]);
+		else
+			val += count1[i]*10;
+	}
+	
+	for (i=0; i<4; i++) {
+		if (total2-count2[i]!=0)
+			val -= count2[i]/(total2-count2[i]);
+		else
+			val -= count2[i]*10;
+	}
+	
+	return val+h_parity(board);
+}
+
+/** Parity of the quadrant just played in: the player who moved
+	there gains if it leaves an even number of empty squares, so that
+	they are likely to get the last move in it. */
+#define PARITYWEIGHT 10
+int h_parity(int *board) {
+	if (JUSTPLAYED(board) <= 0)
+		return 0;
+	return -PARITYWEIGHT*TURN(board)*((PARITY(board) >> quadrant[JUSTPLAYED(board)] & 1) ? -1:1);
+}
+
+/** Mobility difference (based on number of legal moves) */
+int h_mobility(int *board) {
+	return movermobility(board, genmoves(board,NULL)) + oppmobility(board);
+}
+
+/** Potential mobility difference based on how many empty
+	squares are next to an occupied square. Kept up to date by
+	makemove(); see init_totals() for the full count. */
+int h_pmobility(int *board) {
+	return FRONTIER(board);
+}
+
+/** Assign fixed values to each position on the board (a running
+	total kept by makemove()). */
+int h_disksquare(int *board) {
+	return DISKSQUARE(board);
+}
+
+/** Difference in stable pieces */
+int h_stability(int *board) {
+	return 2*P1NUMSTABLE(board)-TOTALNUMSTABLE(board);
+}
+
+/** Estimate stability based on pieces 'attached' to corner pieces. */
+/*int h_cornerstability(int *board) {
+	int val=0, i, j, col, stop;
+	
+	// Top left corner
+	if (board[A1]) {
+		stop = 8;
+		for (j=0; j<8; j++) {
+			for (i=10+j*9, col=0; board[i]==board[10] && col<stop; i++, col++)
+				val+=board[10];
+			if (col==0)
+				break;
+			if (col==1)
+				stop = 1;
+			else
+				stop = col-1;
+		}
+	}
+	
+	// Top right corner
+	if (board[H1]) {
+		stop = 8;
+		for (j=0; j<8; j++) {
+			for (i=10+j*9+7, col=0; board[i]==board[17] && col<stop; i--, col++)
+				val+=board[17];
+			if (col==0)
+				break;
+			if (col==1)
+				stop = 1;
+			else
+				stop = col-1;
+		}
+	}
+	
+	// Bottom left corner
+	if (board[A8]) {
+		stop = 8;
+		for (j=7; j>=0; j--) {
+			for (i=10+j*9, col=0; board[i]==board[73] && col<stop; i++, col++)
+				val+=board[73];
+			if (col==0)
+				break;
+			if (col==1)
+				stop = 1;
+			else
+				stop = col-1;
+		}
+	}
+	
+	// Bottom right corner
+	if (board[H8]) {
+		stop = 8;
+		for (j=7; j>=0; j--) {
+			for (i=10+j*9+7, col=0; board[i]==board[80] && col<stop; i--, col++)
+				val+=board[80];
+			if (col==0)
+				break;
+			if (col==1)
+				stop = 1;
+			else
+				stop = col-1;
+		}
+	}
+	
+	return val;
+}*/
@@ -0,0 +1,243 @@
+/* Generates tables.h, the lookup tables used by board.c and eval.c,
+	for every supported board size. Build and run:
+
+	for n in 6 8 10; do cc -DBOARDSIZE=$n -o gentables gentables.c && ./gentables; done > tables.h
+
+   Each run prints the tables for one size, wrapped in #if BOARDSIZE.
+   The per-square tables replace the divisions in GETX()/GETY() on the
+   hot paths, and edgestable[] gives, for every configuration of
+   pieces on an edge, the pieces that can never be flipped. The square
+   weights and move order are those of the 8x8 board, with the squares
+   of larger boards that are neither near an edge nor in the center
+   weighted like the 8x8 board's third ring. */
+
+#include <stdio.h>
+#include <string.h>
+#include "othello.h"
+
+#define NUMCONFIGS (BOARDSIZE == 6 ? 729 : BOARDSIZE == 8 ? 6561 : 59049)	/* 3^BOARDSIZE */
+
+#define XV 24
+#define CV 5
+/* Weights of the squares of an 8x8 quadrant, indexed by the distances
+	of a square from the nearest edges (see ring()) */
+static const int weights[4][4] = {
+	{500,-CV,  8,  6},
+	{-CV,-XV, -4, -3},
+	{  8, -4,  7,  2},
+	{  6, -3,  2,  5}
+};
+
+/* Order in which moves are tried, as pairs of ring() values: corners,
+	center, edges, the squares diagonal from them, and the squares next
+	to the corners last. */
+static const int order[10][2] = {
+	{0,0}, {3,3}, {0,2}, {2,2}, {0,3}, {2,3}, {1,3}, {1,2}, {0,1}, {1,1}
+};
+
+// Steps along x and y of the directions in dirs[]
+static const int dirx[8] = { -1, 0, 1, -1, 1, -1, 0, 1 };
+static const int diry[8] = { -1, -1, -1, 0, 0, 1, 1, 1 };
+
+static int stable[NUMCONFIGS], known[NUMCONFIGS];
+
+// Edges in the order used by the index: A1-H1, A8-H8, A1-A8, H1-H8
+static int edgepos(int edge, int i) {
+	switch (edge) {
+	case 0: return GETPOS(i,0);
+	case 1: return GETPOS(i,BOARDSIZE-1);
+	case 2: return GETPOS(0,i);
+	default: return GETPOS(BOARDSIZE-1,i);
+	}
+}
+
+/* A configuration is a base-3 number whose first digit is the first
+	square of the edge; 0 is empty, 1 is PLAYER1 and 2 is PLAYER2. */
+static void decode(int index, int *line) {
+	int i;
+	for (i=BOARDSIZE-1; i>=0; i--, index/=3)
+		line[i] = index%3;
+}
+
+static int encode(int *line) {
+	int i, index = 0;
+	for (i=0; i<BOARDSIZE; i++)
+		index = index*3+line[i];
+	return index;
+}
+
+/** Bitmask of the pieces of an edge configuration that are stable:
+	a piece is stable unless some move on the edge, by either player,
+	flips it or leads to a configuration in which it isn't stable. */
+static int edgestable(int index) {
+	int line[BOARDSIZE], tmp[BOARDSIZE];
+	int i, j, k, p, dir, flipped, result = 0;
+
+	if (known[index])
+		return stable[index];
+
+	decode(index,line);
+	for (i=0; i<BOARDSIZE; i++)
+		if (line[i])
+			result |= 1<<i;
+
+	for (i=0; i<BOARDSIZE; i++) {
+		if (line[i])
+			continue;
+		for (p=1; p<=2; p++) {
+			memcpy(tmp,line,sizeof tmp);
+			tmp[i] = p;
+			flipped = 0;
+			for (dir=-1; dir<=1; dir+=2) {
+				for (j=i+dir; j>=0 && j<BOARDSIZE && tmp[j]==3-p; j+=dir);
+				if (j>=0 && j<BOARDSIZE && tmp[j]==p && j!=i+dir) {
+					for (k=i+dir; k!=j; k+=dir) {
+						tmp[k] = p;
+						flipped |= 1<<k;
+					}
+				}
+			}
+			result &= edgestable(encode(tmp)) & ~flipped;
+		}
+	}
+
+	known[index] = 1;
+	return stable[index] = result;
+}
+
+static int onboard(int pos) {
+	return GETX(pos)>=0 && GETX(pos)<BOARDSIZE && pos>=FIRSTSQ && pos<=LASTSQ;
+}
+
+/** Print a table indexed by board position, one row per line, with
+	the given value for positions off the board. */
+static void printsquares(const char *type, const char *name, int (*f)(int), int offboard) {
+	int pos, last = BOARDEND-1;
+
+	printf("static const %s %s[%d] = {", type, name, BOARDEND);
+	for (pos=0; pos<=last; pos++) {
+		if (pos%(BOARDSIZE+1) == 0 && pos != last)
+			printf("\n\t");
+		else
+			printf(" ");
+		printf("%3d%s", onboard(pos) ? f(pos) : offboard, pos==last ? "" : ",");
+	}
+	printf("\n};\n\n");
+}
+
+/** Distance of a row or column from the nearest edge, counted as on
+	an 8x8 board: 0 and 1 next to the edges, 3 in the center, 2 between. */
+static int ring(int i) {
+	if (BOARDSIZE-1-i < i)
+		i = BOARDSIZE-1-i;
+	return (i < 2) ? i : (i == BOARDSIZE/2-1) ? 3 : 2;
+}
+
+static int getx(int pos) { return GETX(pos); }
+static int gety(int pos) { return GETY(pos); }
+static int getdiag1(int pos) { return GETDIAG1(pos); }
+static int getdiag2(int pos) { return GETDIAG2(pos); }
+static int getweight(int pos) { return weights[ring(GETX(pos))][ring(GETY(pos))]; }
+static int getquadrant(int pos) { return (GETX(pos) >= BOARDSIZE/2) + 2*(GETY(pos) >= BOARDSIZE/2); }
+
+/** Directions (bits of dirs[]) in which a move at pos could flip
+	pieces: there must be room for a piece to flip and one beyond it. */
+static int getflipdir(int pos) {
+	int j, x, y, mask = 0;
+	for (j=0; j<8; j++) {
+		x = GETX(pos)+2*dirx[j];
+		y = GETY(pos)+2*diry[j];
+		if (x>=0 && x<BOARDSIZE && y>=0 && y<BOARDSIZE)
+			mask |= 1<<j;
+	}
+	return mask;
+}
+
+/** splitmix64, for the Zobrist keys */
+static uint64_t nextkey(uint64_t *state) {
+	uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+	z = (z ^ (z>>30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z>>27)) * 0x94d049bb133111ebULL;
+	return z ^ (z>>31);
+}
+
+int main() {
+	int i, j, x, y, n;
+	uint64_t state = 0x4f7468656c6c6f21ULL;
+
+	printf("#if BOARDSIZE == %d\n\n", BOARDSIZE);
+	printf("/* Generated by gentables.c - do not edit. */\n\n");
+
+	printf("// Column, row and diagonals of each position\n");
+	printsquares("uint8_t","sq_x",getx,0);
+	printsquares("uint8_t","sq_y",gety,0);
+	printsquares("uint8_t","sq_diag1",getdiag1,0);
+	printsquares("uint8_t","sq_diag2",getdiag2,0);
+
+	printf("/* Bitmask of the directions in dirs[] in which a move at each\n"
+		"\tposition could flip pieces */\n");
+	printsquares("uint8_t","flipdir",getflipdir,0);
+
+	printf("// Fixed value of each square for h_disksquare()\n");
+	printsquares("int16_t","disksquare",getweight,0);
+
+	printf("// Quadrant of each position, 4 off the board\n");
+	printsquares("uint8_t","quadrant",getquadrant,4);
+
+	printf("// Positions ordered from best to worst, the order moves are tried in\n");
+	printf("static const uint8_t positions[NUMTILES] = {");
+	for (i=0, n=0; i<10; i++)
+		for (y=0; y<BOARDSIZE; y++)
+			for (x=0; x<BOARDSIZE; x++)
+				if ((ring(x) == order[i][0] && ring(y) == order[i][1])
+						|| (ring(x) == order[i][1] && ring(y) == order[i][0])) {
+					printf("%s%d%s",(n%16)?" ":"\n\t",GETPOS(x,y),(n==NUMTILES-1)?"":",");
+					n++;
+				}
+	printf("\n};\n\n");
+
+	printf("/* Random keys used to hash positions (Zobrist hashing). zobrist[pos][0]\n"
+		"\tis xored in for a PLAYER1 piece at pos and zobrist[pos][1] for a\n"
+		"\tPLAYER2 piece. ZOBRIST_TURN is xored in when it's PLAYER2's turn. */\n");
+	printf("#define ZOBRIST_TURN 0x%016llxULL\n", (unsigned long long)nextkey(&state));
+	printf("static const uint64_t zobrist[%d][2] = {", BOARDEND);
+	for (i=0; i<BOARDEND; i++) {
+		printf("%s", (i%4) ? " " : "\n\t");
+		if (onboard(i)) {
+			printf("{0x%016llxULL,", (unsigned long long)nextkey(&state));
+			printf("0x%016llxULL}", (unsigned long long)nextkey(&state));
+		}
+		else
+			printf("{0,0}");
+		printf("%s", (i==BOARDEND-1) ? "" : ",");
+	}
+	printf("\n};\n\n");
+
+	printf("// Positions that aren't on an edge, in order\n");
+	printf("#define NUMINNER %d\n",(BOARDSIZE-2)*(BOARDSIZE-2));
+	printf("static const uint8_t inner[NUMINNER] = {");
+	for (y=1; y<BOARDSIZE-1; y++) {
+		for (x=1; x<BOARDSIZE-1; x++)
+			printf("%s%d%s",(x==1)?"\n\t":" ",GETPOS(x,y),(y==BOARDSIZE-2 && x==BOARDSIZE-2)?"":",");
+	}
+	printf("\n};\n\n");
+
+	printf("// Positions along each edge: top, bottom, left, right\n");
+	printf("static const uint8_t edges[4][%d] = {\n",BOARDSIZE);
+	for (i=0; i<4; i++) {
+		printf("\t{");
+		for (j=0; j<BOARDSIZE; j++)
+			printf("%d%s",edgepos(i,j),j==BOARDSIZE-1?"":", ");
+		printf("}%s\n",i==3?"":",");
+	}
+	printf("};\n\n");
+
+	printf("/* Stable pieces for each configuration of an edge, indexed as in\n"
+		"\tgentables.c; bit i is set if the i-th piece of the edge is stable. */\n");
+	printf("static const %s edgestable[%d] = {",BOARDSIZE > 8 ? "uint16_t" : "uint8_t",NUMCONFIGS);
+	for (i=0; i<NUMCONFIGS; i++)
+		printf("%s%3d%s",(i%16)?"":"\n\t",edgestable(i),(i==NUMCONFIGS-1)?"":",");
+	printf("\n};\n\n#endif\n\n");
+
+	return 0;
+}
@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include "engine.h"
+#include "match.h"
+
+/* Self-play between alpha-beta and MCTS at the same time per move.
+	Games come in pairs: both start with the same few random moves and
+	the engines swap colors for the second, so that neither profits
+	from a lucky opening. */
+
+struct side {
+	const char *name;
+	struct engine *e;
+	unsigned long nodes;	/* Over all its moves */
+	double time;
+};
+
+/** Play one game, with sides[0] moving first after the opening.
+	Returns the final disk difference for sides[0]. */
+static int playgame(struct side **sides, unsigned int seed) {
+	struct searchresult result;
+	int board[ARRSIZE], legalmoves[MAXMOVES], flipped[MAXMOVES];
+	int i, s;
+
+	defaultboard(board);
+	for (i=0; i<MATCH_OPENING; i++) {
+		getmoves(board, legalmoves);
+		seed = seed*1103515245 + 12345;
+		results(board, legalmoves[1 + (seed>>16) % legalmoves[0]], flipped);
+	}
+	engine_newgame(sides[0]->e);
+	engine_newgame(sides[1]->e);
+
+	for (;;) {
+		getmoves(board, legalmoves);
+		if (terminaltest(legalmoves, board))
+			break;
+		if (NOMOVES(legalmoves)) {
+			results(board, -1, flipped);
+			continue;
+		}
+		// The side to move: after MATCH_OPENING moves it's PLAYER1 for even counts
+		s = (TURN(board) == PLAYER1) == (MATCH_OPENING % 2 == 0) ? 0 : 1;
+		engine_setposition(sides[s]->e, board);
+		engine_search(sides[s]->e, &result);
+		sides[s]->nodes += result.nodes;
+		sides[s]->time += result.time;
+		results(board, result.move, flipped);
+	}
+	s = 2*P1PIECES(board) - ACTIVEPIECES(board);
+	return (MATCH_OPENING % 2 == 0) ? s : -s;
+}
+
+/** Play the given number of games between an alpha-beta engine and
+	an MCTS engine on the given number of threads, with a time limit
+	per move, and print each result and the totals: wins, draws and
+	losses of MCTS, the nodes per second of alpha-beta and the playouts
+	per second of MCTS. Returns 0, or -1 if the engines couldn't be
+	created. */
+int match_run(int games, double seconds, int threads) {
+	struct side ab = { "alphabeta", NULL, 0, 0 }, mc = { "mcts", NULL, 0, 0 };
+	struct searchlimits limits = {0};
+	struct side *pair[2];
+	int i, diff, wins = 0, draws = 0, losses = 0;
+
+	if ((ab.e = engine_create()) == NULL || (mc.e = engine_create()) == NULL
+			|| engine_setmode(mc.e, ENGINE_MCTS, threads) < 0) {
+		fprintf(stderr,"Error: Could not create the engines.\n");
+		if (ab.e)
+			engine_destroy(ab.e);
+		if (mc.e)
+			engine_destroy(mc.e);
+		return -1;
+	}
+	limits.time = seconds;
+	engine_setlimits(ab.e, &limits);
+	engine_setlimits(mc.e, &limits);
+
+	for (i=0; i<games; i++) {
+		// Alpha-beta moves first in even games
+		pair[0] = (i % 2) ? &mc : &ab;
+		pair[1] = (i % 2) ? &ab : &mc;
+		diff = playgame(pair, i/2 + 1);
+		if (pair[0] != &mc)
+			diff = -diff;
+		wins += diff > 0;
+		draws += diff == 0;
+		losses += diff < 0;
+		printf("game %3d  %-9s moves first  mcts %+d\n", i+1, pair[0]->name, diff);
+		fflush(stdout);
+	}
+
+	printf("\nmcts (%d thread%s) against alphabeta at %.2f s per move: %d wins, %d draws, %d losses\n",
+			threads, threads == 1 ? "" : "s", seconds, wins, draws, losses);
+	printf("alphabeta  %12.0f nodes/s\nmcts       %12.0f playouts/s\n",
+			ab.time > 0 ? ab.nodes/ab.time : 0.0, mc.time > 0 ? mc.nodes/mc.time : 0.0);
+
+	engine_destroy(ab.e);
+	engine_destroy(mc.e);
+	return 0;
+}
@@ -0,0 +1,10 @@
+#ifndef MATCH_H
+#define MATCH_H
+
+#define MATCH_GAMES 10		/* Default number of games */
+#define MATCH_TIME 1.0		/* Default seconds per move */
+#define MATCH_OPENING 4		/* Random moves before the engines take over */
+
+int match_run(int games, double seconds, int threads);
+
+#endif
@@ -0,0 +1,585 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include "engine.h"
+#include "mcts.h"
+
+/* Monte Carlo tree search. Every playout walks down the tree from the
+	root choosing children by UCT, adds children to the leaf it reaches
+	once that has been visited MCTS_EXPAND times, then plays random
+	moves to the end of the game and credits the result to every node
+	on its path. The move chosen is the root child visited most.
+
+	Playouts work on a bare copy of the squares (getsquares()) with
+	flipsquares(), without the metadata and stability updates of
+	makemove(). A random legal move is found by trying the empty
+	squares in random order until one flips something, which picks
+	uniformly among the legal moves without generating them all.
+
+	Nodes come from a preallocated pool, the children of a node being
+	consecutive. Between searches the subtree of the new position, if
+	the previous tree reaches it, is copied to the front of a second
+	pool that then takes the first one's place, so the tree is reused
+	from move to move and the pool never fragments.
+
+	Several threads search one tree; they are started with it and wait
+	between iterations. Counters are updated atomically, and a node's
+	visit is counted on the way down while its result is only added on
+	the way back, so until then it looks like a loss ("virtual loss")
+	and steers the other threads elsewhere. Whichever thread first
+	claims a leaf expands it; the others play out from the leaf
+	meanwhile.
+
+	A search runs in iterations like iterative deepening: the first
+	runs MCTS_FIRSTSLICE playouts and each following one as many as
+	all before it, so a depth limit of d allows MCTS_FIRSTSLICE<<(d-1)
+	playouts. The score is the expected result of the best move in
+	thousandths, from -1000 (certain loss) to 1000 (certain win). */
+
+#define LEAF 0
+#define EXPANDING 1
+#define EXPANDED 2
+
+#define CHUNK 64	/* Playouts a thread claims at a time */
+
+#define LOAD(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define STORE(x,v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#define ADD(x,v) __atomic_fetch_add(&(x), (v), __ATOMIC_RELAXED)
+
+struct mctsnode {
+	uint32_t children;		/* Index of the first child in the pool */
+	uint8_t nchildren;
+	uint8_t move;			/* Move that led here, 0 for a pass */
+	uint8_t state;			/* LEAF, EXPANDING or EXPANDED */
+	uint8_t pad;
+	uint32_t visits;
+	uint32_t score;			/* Results for the player who made the move:
+								2 per win, 1 per draw */
+};
+
+struct worker {
+	struct mcts *m;
+	unsigned int seed;
+	pthread_t thread;
+};
+
+struct mcts {
+	struct mctsnode *pool;	/* The tree, rooted at pool[0] */
+	struct mctsnode *spare;	/* Where the tree is compacted between searches */
+	int kind, sparekind;
+	uint32_t size;			/* Nodes in each pool */
+	uint32_t used;			/* Nodes allocated */
+	int nthreads;
+	unsigned int seed;
+
+	int board[ARRSIZE];		/* Root position */
+	int8_t rootsq[BOARDEND];
+	uint8_t rootempties[NUMTILES];
+	int numempties, rootdiff;
+	int rootmoves[MAXMOVES];
+
+	struct searchlimits limits;
+	double starttime;
+	volatile double timelimit;	/* limits.time, until changed by mcts_extend() */
+	volatile int stop;
+	unsigned long playouts;	/* Finished in this search */
+	unsigned long target;	/* Playouts claimed by the current iteration may not pass this */
+	unsigned long claimed;
+	int iter;
+
+	/* Helper threads, started with the tree and kept until it is freed,
+		search each iteration with the thread calling mcts_iterate(). */
+	struct worker workers[MCTS_MAXTHREADS];	/* [0] is the caller's */
+	int nhelpers;
+	pthread_mutex_t lock;
+	pthread_cond_t start;	/* Signalled when an iteration is handed out */
+	pthread_cond_t done;	/* Signalled when the last helper finishes it */
+	unsigned long handed;	/* Iterations handed out (guarded by lock) */
+	int busy;				/* Helpers still on the current one (guarded by lock) */
+	int quit;				/* Helpers should exit (guarded by lock) */
+};
+
+static double now(void) {
+	struct timeval tv;
+	gettimeofday(&tv,NULL);
+	return tv.tv_sec+(tv.tv_usec/1000000.0);
+}
+
+static unsigned int nextrand(unsigned int *seed) {
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 17;
+	*seed ^= *seed << 5;
+	return *seed;
+}
+
+/** A random number below n */
+static inline int randbelow(unsigned int *seed, int n) {
+	return (int)(((uint64_t)nextrand(seed) * n) >> 32);
+}
+
+static void *helper(void *arg);
+
+/** Search with nthreads threads and a tree that fits in the given
+	number of bytes, together with the rest of the search state. Returns
+	NULL if the memory can't be allocated or is too little. */
+struct mcts *mcts_create(int nthreads, size_t bytes) {
+	struct mcts *m;
+	size_t size;
+	int i;
+
+	if (bytes < sizeof *m)
+		return NULL;
+	size = (bytes - sizeof *m) / (2 * sizeof(struct mctsnode));
+	if (size < MCTS_MINNODES)
+		return NULL;
+	if (size > UINT32_MAX/2)	// Node indices are 32 bits
+		size = UINT32_MAX/2;
+	bytes = size * sizeof(struct mctsnode);
+	if ((m = calloc(1, sizeof *m)) == NULL)
+		return NULL;
+	if ((m->pool = mem_alloc(bytes, &m->kind)) == NULL) {
+		free(m);
+		return NULL;
+	}
+	if ((m->spare = mem_alloc(bytes, &m->sparekind)) == NULL) {
+		mem_free(m->pool, bytes);
+		free(m);
+		return NULL;
+	}
+	m->size = (uint32_t)size;
+	m->nthreads = nthreads < 1 ? 1 : nthreads > MCTS_MAXTHREADS ? MCTS_MAXTHREADS : nthreads;
+	m->seed = 1;
+
+	pthread_mutex_init(&m->lock, NULL);
+	pthread_cond_init(&m->start, NULL);
+	pthread_cond_init(&m->done, NULL);
+	for (i=0; i<m->nthreads; i++)
+		m->workers[i].m = m;
+	for (i=1; i<m->nthreads; i++)	// With fewer threads the search is just slower
+		if (pthread_create(&m->workers[i].thread, NULL, helper, &m->workers[i]) != 0)
+			break;
+	m->nhelpers = i-1;
+	return m;
+}
+
+void mcts_destroy(struct mcts *m) {
+	int i;
+
+	if (m) {
+		pthread_mutex_lock(&m->lock);
+		m->quit = 1;
+		pthread_cond_broadcast(&m->start);
+		pthread_mutex_unlock(&m->lock);
+		for (i=1; i<=m->nhelpers; i++)
+			pthread_join(m->workers[i].thread, NULL);
+		pthread_cond_destroy(&m->start);
+		pthread_cond_destroy(&m->done);
+		pthread_mutex_destroy(&m->lock);
+		mem_free(m->pool, m->size * sizeof *m->pool);
+		mem_free(m->spare, m->size * sizeof *m->spare);
+		free(m);
+	}
+}
+
+/** Forget the tree of the previous game. */
+void mcts_newgame(struct mcts *m) {
+	m->used = 0;
+}
+
+void mcts_setseed(struct mcts *m, unsigned int seed) {
+	m->seed = seed ? seed : 1;
+}
+
+void mcts_stop(struct mcts *m) {
+	m->stop = 1;
+}
+
+/** Give the running search more time, see engine_extend(). */
+void mcts_extend(struct mcts *m, double seconds) {
+	if (seconds <= 0)
+		m->timelimit = 0;
+	else if (m->timelimit > 0)
+		m->timelimit += seconds;
+}
+
+/** Bytes of both node pools and the search state. If kind isn't NULL
+	it is set to how the pool holding the tree is backed (see memory.h). */
+size_t mcts_memory(struct mcts *m, int *kind) {
+	if (kind)
+		*kind = m->kind;
+	return sizeof *m + 2 * (size_t)m->size * sizeof *m->pool;
+}
+
+/** Play the move of a node (0 for a pass) on squares, keeping the
+	list of empty squares and the disk difference up to date. */
+static inline void playmove(int8_t *sq, uint8_t *empties, int *ne, int *diff, int move, int player) {
+	int i;
+
+	if (move == 0)
+		return;
+	*diff += player * (2*flipsquares(sq, move, player) + 1);
+	for (i=0; empties[i]!=move; i++);
+	empties[i] = empties[--*ne];
+}
+
+/** Find the node of a position in the previous tree, at most two
+	moves (or passes) below its root. Returns its index, or -1. */
+static int findposition(struct mcts *m, const int *board) {
+	int8_t sq[BOARDEND], child[BOARDEND], grandchild[BOARDEND], target[BOARDEND];
+	struct mctsnode *a, *b;
+	int i, j, player = TURN(m->board);
+
+	if (m->used == 0 || m->pool[0].state != EXPANDED)
+		return -1;
+	getsquares(m->board, sq);
+	getsquares(board, target);
+	if (memcmp(sq, target, sizeof sq) == 0 && TURN(board) == player)
+		return 0;
+
+	for (i=0; i<m->pool[0].nchildren; i++) {
+		a = &m->pool[m->pool[0].children+i];
+		memcpy(child, sq, sizeof child);
+		if (a->move)
+			flipsquares(child, a->move, player);
+		if (memcmp(child, target, sizeof child) == 0 && TURN(board) == -player)
+			return m->pool[0].children+i;
+		if (a->state != EXPANDED)
+			continue;
+		for (j=0; j<a->nchildren; j++) {
+			b = &m->pool[a->children+j];
+			memcpy(grandchild, child, sizeof grandchild);
+			if (b->move)
+				flipsquares(grandchild, b->move, -player);
+			if (memcmp(grandchild, target, sizeof grandchild) == 0 && TURN(board) == player)
+				return a->children+j;
+		}
+	}
+	return -1;
+}
+
+/** Copy the subtree below pool[root] to the front of the spare pool,
+	breadth first, and make that the tree. */
+static void reroot(struct mcts *m, int root) {
+	struct mctsnode *src = m->pool, *dst = m->spare;
+	uint32_t i, used = 1;
+	int kind;
+
+	dst[0] = src[root];
+	for (i=0; i<used; i++) {
+		if (dst[i].state != EXPANDED)
+			continue;
+		memcpy(dst+used, src+dst[i].children, dst[i].nchildren * sizeof *dst);
+		dst[i].children = used;
+		used += dst[i].nchildren;
+	}
+
+	m->pool = dst;
+	m->spare = src;
+	kind = m->kind;
+	m->kind = m->sparekind;
+	m->sparekind = kind;
+	m->used = used;
+}
+
+/** Start a search of the position, reusing what the previous search
+	learned about it. The search runs one iteration at a time in
+	mcts_iterate(). */
+void mcts_begin(struct mcts *m, const int *board, const struct searchlimits *limits,
+		struct searchresult *result) {
+	int i, root = findposition(m, board);
+
+	if (root > 0)
+		reroot(m, root);
+	else if (root < 0) {
+		memset(&m->pool[0], 0, sizeof *m->pool);
+		m->used = 1;
+	}
+
+	memcpy(m->board, board, sizeof m->board);
+	getsquares(m->board, m->rootsq);
+	for (i=0, m->numempties=0; i<BOARDEND; i++)
+		if (m->rootsq[i] == EMPTY)
+			m->rootempties[m->numempties++] = i;
+	m->rootdiff = 2*P1PIECES(board) - ACTIVEPIECES(board);
+	getmoves(m->board, m->rootmoves);
+
+	m->limits = *limits;
+	m->timelimit = limits->time;
+	m->starttime = now();
+	m->stop = 0;
+	m->playouts = m->claimed = 0;
+	m->iter = 0;
+
+	memset(result, 0, sizeof *result);
+	result->movenum = 1;
+	result->move = result->pv[0] = m->rootmoves[1];
+	result->pvlength = 1;
+}
+
+/** Give a leaf its children: one per legal move, a single pass if
+	there is none but the game goes on, or none at the end of the game. */
+static void expand(struct mcts *m, struct mctsnode *node, const int8_t *sq,
+		const uint8_t *empties, int ne, int player) {
+	uint8_t moves[MAXMOVES];
+	int8_t tmp[BOARDEND];
+	int i, n = 0;
+	uint32_t first;
+
+	for (i=0; i<ne; i++) {
+		memcpy(tmp, sq, sizeof tmp);
+		if (flipsquares(tmp, empties[i], player))
+			moves[n++] = empties[i];
+	}
+	if (n == 0) {
+		for (i=0; i<ne; i++) {
+			memcpy(tmp, sq, sizeof tmp);
+			if (flipsquares(tmp, empties[i], -player))
+				break;
+		}
+		if (i < ne)
+			moves[n++] = 0;	// Pass
+	}
+
+	if (n) {
+		first = ADD(m->used, n);
+		if (first + n > m->size) {	// Full: the node stays a leaf
+			STORE(node->state, LEAF);
+			return;
+		}
+		for (i=0; i<n; i++) {
+			memset(&m->pool[first+i], 0, sizeof *m->pool);
+			m->pool[first+i].move = moves[i];
+		}
+		node->children = first;
+	}
+	node->nchildren = n;
+	STORE(node->state, EXPANDED);
+}
+
+/** The child with the best UCT value. Unvisited children go first. */
+static struct mctsnode *uct(struct mcts *m, struct mctsnode *node) {
+	struct mctsnode *child = &m->pool[node->children], *best = child;
+	double logn = log((double)LOAD(node->visits)), val, bestval = -1;
+	uint32_t visits;
+	int i;
+
+	for (i=0; i<node->nchildren; i++, child++) {
+		if ((visits = LOAD(child->visits)) == 0)
+			return child;
+		val = LOAD(child->score) / (2.0*visits) + MCTS_UCT * sqrt(logn / visits);
+		if (val > bestval) {
+			bestval = val;
+			best = child;
+		}
+	}
+	return best;
+}
+
+/** Play random moves to the end of the game. Returns the final disk
+	difference for PLAYER1. */
+static int rollout(int8_t *sq, uint8_t *empties, int ne, int diff, int player, unsigned int *seed) {
+	int k, r, pos, n, passes = 0;
+
+	while (ne > 0 && passes < 2) {
+		// Try empty squares in random order, moving each failure to the end
+		for (k=ne; k>0; k--) {
+			r = randbelow(seed, k);
+			pos = empties[r];
+			if ((n = flipsquares(sq, pos, player)) > 0)
+				break;
+			empties[r] = empties[k-1];
+			empties[k-1] = pos;
+		}
+		if (k) {
+			diff += player * (2*n + 1);
+			empties[r] = empties[--ne];
+			passes = 0;
+		}
+		else
+			passes++;
+		player = -player;
+	}
+	return diff;
+}
+
+/** One playout from the root, with everything it learns added to the tree. */
+static void playout(struct mcts *m, unsigned int *seed) {
+	struct mctsnode *path[2*NUMTILES+2], *node = &m->pool[0];
+	int8_t sq[BOARDEND];
+	uint8_t empties[NUMTILES];
+	int i, len = 0, ne = m->numempties, diff = m->rootdiff;
+	int player = TURN(m->board), mover;
+	uint32_t win, draw;
+
+	memcpy(sq, m->rootsq, sizeof sq);
+	memcpy(empties, m->rootempties, ne);
+
+	ADD(node->visits, 1);
+	path[len++] = node;
+	while (LOAD(node->state) == EXPANDED && node->nchildren) {
+		node = uct(m, node);
+		ADD(node->visits, 1);	// Counted as a loss until the result is in
+		path[len++] = node;
+		playmove(sq, empties, &ne, &diff, node->move, player);
+		player = -player;
+	}
+
+	if (LOAD(node->state) == LEAF && LOAD(node->visits) >= MCTS_EXPAND
+			&& LOAD(m->used) + MAXMOVES <= m->size) {
+		uint8_t expected = LEAF;
+		if (__atomic_compare_exchange_n(&node->state, &expected, EXPANDING, 0,
+				__ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+			expand(m, node, sq, empties, ne, player);
+	}
+
+	diff = rollout(sq, empties, ne, diff, player, seed);
+
+	// The move into path[i] was made by the side to move at path[i-1]
+	mover = TURN(m->board);
+	win = diff > 0 ? PLAYER1 : diff < 0 ? PLAYER2 : 0;
+	for (i=1; i<len; i++, mover = -mover) {
+		draw = win == 0;
+		if (draw || (int)win == mover)
+			ADD(path[i]->score, draw ? 1 : 2);
+	}
+}
+
+static void *work(void *arg) {
+	struct worker *w = arg;
+	struct mcts *m = w->m;
+	unsigned long first;
+	int i, n;
+
+	while (!m->stop) {
+		first = ADD(m->claimed, CHUNK);
+		if (first >= m->target)
+			break;
+		n = m->target - first < CHUNK ? (int)(m->target - first) : CHUNK;
+		for (i=0; i<n; i++)
+			playout(m, &w->seed);
+		ADD(m->playouts, n);
+		if (m->timelimit && now()-m->starttime >= m->timelimit)
+			m->stop = 1;
+	}
+	return NULL;
+}
+
+/** Helper thread: search every iteration handed out until the tree is
+	freed. */
+static void *helper(void *arg) {
+	struct worker *w = arg;
+	struct mcts *m = w->m;
+	unsigned long handed = 0;
+
+	pthread_mutex_lock(&m->lock);
+	for (;;) {
+		while (m->handed == handed && !m->quit)
+			pthread_cond_wait(&m->start, &m->lock);
+		if (m->quit)
+			break;
+		handed = m->handed;
+		pthread_mutex_unlock(&m->lock);
+		work(w);
+		pthread_mutex_lock(&m->lock);
+		if (--m->busy == 0)
+			pthread_cond_signal(&m->done);
+	}
+	pthread_mutex_unlock(&m->lock);
+	return NULL;
+}
+
+/** The child of a node visited most, or NULL if it has none. */
+static struct mctsnode *mostvisited(struct mcts *m, struct mctsnode *node) {
+	struct mctsnode *best = NULL, *child;
+	int i;
+
+	if (node->state != EXPANDED)
+		return NULL;
+	for (i=0; i<node->nchildren; i++) {
+		child = &m->pool[node->children+i];
+		if (best == NULL || child->visits > best->visits)
+			best = child;
+	}
+	return best;
+}
+
+/** For an analysis, the score of every root move, most visited first. */
+static void scoremoves(struct mcts *m, struct searchresult *result) {
+	struct mctsnode *root = &m->pool[0], *child;
+	struct movescore ms;
+	int i, j;
+
+	result->nummoves = 0;
+	if (root->state != EXPANDED)
+		return;
+	for (i=0; i<root->nchildren; i++) {
+		child = &m->pool[root->children+i];
+		ms.move = child->move ? child->move : -1;
+		ms.score = child->visits ? (int)(1000.0*child->score/child->visits) - 1000 : 0;
+		ms.bound = child->visits;	// Sort key until the loop below
+		for (j=i; j>0 && result->moves[j-1].bound < ms.bound; j--)
+			result->moves[j] = result->moves[j-1];
+		result->moves[j] = ms;
+	}
+	for (i=0; i<root->nchildren; i++)
+		result->moves[i].bound = TT_EXACT;
+	result->nummoves = root->nchildren;
+}
+
+/** Run the next iteration and update *result. Returns nonzero if the
+	search could be continued with another call. */
+int mcts_iterate(struct mcts *m, struct searchresult *result) {
+	struct worker *workers = m->workers;
+	struct mctsnode *node, *best;
+	unsigned long slice;
+	int i;
+
+	if (m->rootmoves[0] <= 1 || m->stop)
+		return 0;
+	if (m->limits.depth && m->iter >= m->limits.depth)
+		return 0;
+
+	slice = m->playouts ? m->playouts : MCTS_FIRSTSLICE;
+	m->target = m->playouts + slice;
+	if (m->limits.nodes && m->target > m->limits.nodes)
+		m->target = m->limits.nodes;
+	m->claimed = m->playouts;
+
+	for (i=0; i<=m->nhelpers; i++) {
+		workers[i].seed = m->seed + i*0x9e3779b9u;
+		if (workers[i].seed == 0)
+			workers[i].seed = 1;
+	}
+	pthread_mutex_lock(&m->lock);
+	m->handed++;
+	m->busy = m->nhelpers;
+	pthread_cond_broadcast(&m->start);
+	pthread_mutex_unlock(&m->lock);
+	work(&workers[0]);
+	pthread_mutex_lock(&m->lock);
+	while (m->busy)
+		pthread_cond_wait(&m->done, &m->lock);
+	pthread_mutex_unlock(&m->lock);
+	m->seed = workers[0].seed;
+
+	result->nodes = m->playouts;
+	result->time = now()-m->starttime;
+	if (!m->stop)
+		result->depth = ++m->iter;
+
+	if ((best = mostvisited(m, &m->pool[0])) != NULL) {
+		for (i=1; i<=m->rootmoves[0] && m->rootmoves[i] != (best->move ? best->move : -1); i++);
+		result->movenum = i;
+		result->move = m->rootmoves[i];
+		result->score = best->visits ? (int)(1000.0*best->score/best->visits) - 1000 : 0;
+		result->pvlength = 0;
+		for (node=best; node && result->pvlength<MAXPLY; node=mostvisited(m, node))
+			result->pv[result->pvlength++] = node->move ? node->move : -1;
+	}
+	if (m->limits.multipv)
+		scoremoves(m, result);
+
+	return !m->stop && (!m->limits.nodes || m->playouts < m->limits.nodes);
+}
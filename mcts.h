@@ -0,0 +1,32 @@
+#ifndef MCTS_H
+#define MCTS_H
+
+#include "othello.h"
+
+/* Monte Carlo tree search with UCT, the alternative to alpha-beta
+	selected with engine_setmode(). Used through the engine API; see
+	mcts.c for how it works. */
+
+#define MCTS_DEFAULTSIZE (64<<20)	/* Bytes of the tree, in two pools */
+#define MCTS_MINNODES 4096		/* Smallest pool (16 bytes a node) */
+#define MCTS_FIRSTSLICE 1024	/* Playouts of the first iteration */
+#define MCTS_EXPAND 2			/* Visits before a leaf gets children */
+#define MCTS_UCT 0.6			/* Exploration constant of UCT */
+#define MCTS_MAXTHREADS 64
+
+struct mcts;
+struct searchlimits;
+struct searchresult;
+
+struct mcts *mcts_create(int nthreads, size_t bytes);
+void mcts_destroy(struct mcts *m);
+void mcts_newgame(struct mcts *m);
+void mcts_begin(struct mcts *m, const int *board, const struct searchlimits *limits,
+		struct searchresult *result);
+int mcts_iterate(struct mcts *m, struct searchresult *result);
+void mcts_stop(struct mcts *m);
+void mcts_extend(struct mcts *m, double seconds);
+void mcts_setseed(struct mcts *m, unsigned int seed);
+size_t mcts_memory(struct mcts *m, int *kind);
+
+#endif
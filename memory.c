@@ -0,0 +1,81 @@
+#include <stdlib.h>
+#include "memory.h"
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+/* Hash tables are probed at random, so with ordinary 4 KB pages
+	nearly every probe of a large table also misses the TLB. Tables
+	are therefore allocated from huge pages when the system has them:
+	reserved ones if any are free, otherwise ordinary memory with a
+	request for transparent huge pages, aligned so that the whole
+	table can be backed by them. Elsewhere they simply come from
+	calloc(). */
+
+/** Allocate zeroed memory for a table, to be freed by mem_free()
+	with the same size. *kind tells how it is backed. Returns NULL if
+	there isn't enough memory. */
+void *mem_alloc(size_t bytes, int *kind) {
+#ifdef __linux__
+	char *p, *start;
+	size_t rounded = (bytes+MEM_HUGEPAGE-1) & ~(MEM_HUGEPAGE-1), head;
+
+#ifdef MAP_HUGETLB
+	if (bytes >= MEM_HUGEPAGE) {
+		p = mmap(NULL, rounded, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0);
+		if (p != MAP_FAILED) {
+			*kind = MEM_HUGETLB;
+			return p;
+		}
+	}
+#endif
+	if (bytes < MEM_HUGEPAGE) {
+		*kind = MEM_NORMAL;
+		return calloc(1, bytes);
+	}
+
+	// Map an extra huge page to be able to align to one, then trim
+	if ((start = mmap(NULL, rounded+MEM_HUGEPAGE, PROT_READ|PROT_WRITE,
+			MAP_PRIVATE|MAP_ANONYMOUS, -1, 0)) == MAP_FAILED)
+		return NULL;
+	p = (char *)(((size_t)start+MEM_HUGEPAGE-1) & ~(MEM_HUGEPAGE-1));
+	if ((head = p-start) > 0)
+		munmap(start, head);
+	munmap(p+rounded, MEM_HUGEPAGE-head);
+
+	*kind = MEM_NORMAL;
+#ifdef MADV_HUGEPAGE
+	if (madvise(p, rounded, MADV_HUGEPAGE) == 0)
+		*kind = MEM_THP;
+#endif
+	return p;
+#else
+	*kind = MEM_NORMAL;
+	return calloc(1, bytes);
+#endif
+}
+
+void mem_free(void *p, size_t bytes) {
+#ifdef __linux__
+	if (p && bytes >= MEM_HUGEPAGE) {
+		munmap(p, (bytes+MEM_HUGEPAGE-1) & ~(MEM_HUGEPAGE-1));
+		return;
+	}
+#endif
+	(void)bytes;
+	free(p);
+}
+
+/** Divide a memory budget between an engine and its endgame cache. */
+void mem_split(size_t budget, struct membudget *b) {
+	b->ecache = budget/MEM_ECSHARE;
+	b->engine = budget-b->ecache;
+}
+
+const char *mem_kindname(int kind) {
+	switch (kind) {
+	case MEM_HUGETLB: return "huge pages";
+	case MEM_THP: return "transparent huge pages";
+	default: return "normal pages";
+	}
+}
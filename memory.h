@@ -0,0 +1,29 @@
+#ifndef MEMORY_H
+#define MEMORY_H
+
+#include <stddef.h>
+
+/* Allocation of the large hash tables, and how a memory budget is
+	shared between them. */
+
+#define MEM_HUGEPAGE ((size_t)2<<20)
+#define MEM_ECSHARE 4	/* The endgame cache gets 1/MEM_ECSHARE of a budget */
+
+// How a block of memory is backed, as reported by mem_alloc()
+#define MEM_NORMAL 0
+#define MEM_HUGETLB 1	/* Reserved huge pages (MAP_HUGETLB) */
+#define MEM_THP 2		/* Transparent huge pages (madvise) */
+
+/** How a budget is divided: the engine (its transposition table and
+	search state) and the endgame cache it uses. */
+struct membudget {
+	size_t engine;
+	size_t ecache;
+};
+
+void *mem_alloc(size_t bytes, int *kind);
+void mem_free(void *p, size_t bytes);
+void mem_split(size_t budget, struct membudget *b);
+const char *mem_kindname(int kind);
+
+#endif
@@ -0,0 +1,230 @@
+/* Microbenchmarks for the move generation and evaluation kernels.
+	Build and run:
+
+	cc -O2 -o microbench microbench.c board.c eval.c && ./microbench
+
+   Every kernel is timed over the same corpus of positions, taken from
+   games of random moves played with a fixed seed so that it covers all
+   phases of the game and is identical from run to run. Results can be
+   saved to a baseline file and later runs compared against it:
+
+	./microbench -s baseline.txt
+	./microbench -b baseline.txt [-r percent]
+
+   The comparison lists every kernel that got slower by more than the
+   given percentage (5 by default) and exits with status 1 if any did. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "othello.h"
+
+#define CORPUSGAMES 32
+#define MAXPOSITIONS (CORPUSGAMES*NUMTILES)
+#define MINTIME 0.2		/* Default seconds spent on each kernel */
+#define THRESHOLD 5.0	/* Default regression threshold in percent */
+#define MAXKERNELS 32
+
+static int corpus[MAXPOSITIONS][ARRSIZE];
+static int numpositions;
+static volatile long sink;	/* Keeps the compiler from dropping results */
+
+/** Seconds on a monotonic clock */
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec/1e9;
+}
+
+/** Play games of random moves and keep every position. */
+static void buildcorpus(void) {
+	int board[ARRSIZE], moves[MAXMOVES], flipped[MAXMOVES];
+	unsigned int seed = 12345;
+	int g;
+
+	for (g=0; g<CORPUSGAMES; g++) {
+		defaultboard(board);
+		for (;;) {
+			getmoves(board, moves);
+			if (terminaltest(moves, board) || numpositions == MAXPOSITIONS)
+				break;
+			memcpy(corpus[numpositions++], board, sizeof board);
+			seed ^= seed << 13;
+			seed ^= seed >> 17;
+			seed ^= seed << 5;
+			results(board, moves[1 + seed % moves[0]], flipped);
+		}
+	}
+}
+
+/* Each kernel runs once on a position and returns the number of
+	calls it made, which is more than one for the move kernels. */
+
+static int k_getmoves(int *board) {
+	int moves[MAXMOVES];
+	getmoves(board, moves);
+	sink += moves[1];
+	return 1;
+}
+
+static int k_genmoves(int *board) {
+	sink += genmoves(board, NULL);
+	return 1;
+}
+
+static int k_makeundo(int *board) {
+	uint8_t moves[MAXMOVES];
+	struct undo u;
+	int i, n = genmoves(board, moves);
+	for (i=0; i<n; i++) {
+		makemove(board, moves[i], &u);
+		sink += P1PIECES(board);
+		undomove(board, &u);
+	}
+	return n;
+}
+
+static int k_updatestability(int *board) {
+	uint8_t newstable[NUMTILES];
+	sink += updatestability(board, newstable);
+	return 1;
+}
+
+static int k_hashboard(int *board) {
+	sink += (long)hashboard(board);
+	return 1;
+}
+
+/* evaluation() as the search calls it at a leaf, with a null window */
+static int k_lazyevaluation(int *board) {
+	sink += lazyevaluation(board, -1, 0, 1);
+	return 1;
+}
+
+#define HEURISTIC(f) static int k_##f(int *board) { sink += f(board); return 1; }
+HEURISTIC(evaluation)
+HEURISTIC(h_diskdiff)
+HEURISTIC(h_mobility)
+HEURISTIC(h_pmobility)
+HEURISTIC(h_disksquare)
+HEURISTIC(h_edges)
+HEURISTIC(h_stability)
+HEURISTIC(h_topology)
+
+static const struct {
+	const char *name;
+	int (*run)(int *board);
+} kernels[] = {
+	{ "getmoves",			k_getmoves },
+	{ "genmoves(count)",	k_genmoves },
+	{ "makemove+undomove",	k_makeundo },
+	{ "updatestability",	k_updatestability },
+	{ "hashboard",			k_hashboard },
+	{ "evaluation",			k_evaluation },
+	{ "lazyevaluation",		k_lazyevaluation },
+	{ "h_diskdiff",			k_h_diskdiff },
+	{ "h_mobility",			k_h_mobility },
+	{ "h_pmobility",		k_h_pmobility },
+	{ "h_disksquare",		k_h_disksquare },
+	{ "h_edges",			k_h_edges },
+	{ "h_stability",		k_h_stability },
+	{ "h_topology",			k_h_topology },
+};
+
+#define NUMKERNELS ((int)(sizeof kernels / sizeof *kernels))
+
+/** Run a kernel over the whole corpus until mintime has passed.
+	Returns nanoseconds per call. */
+static double timekernel(int k, double mintime, double *callspersec) {
+	double start = now(), elapsed;
+	unsigned long calls = 0;
+	int i;
+
+	do {
+		for (i=0; i<numpositions; i++)
+			calls += kernels[k].run(corpus[i]);
+		elapsed = now()-start;
+	}
+	while (elapsed < mintime);
+
+	*callspersec = calls/elapsed;
+	return elapsed*1e9/calls;
+}
+
+/** Read "name ns" lines saved by -s. Returns the number read or -1. */
+static int loadbaseline(const char *fname, char names[][64], double *ns) {
+	FILE *fp;
+	int n = 0;
+
+	if ((fp = fopen(fname, "r")) == NULL)
+		return -1;
+	while (n < MAXKERNELS && fscanf(fp, "%63s %lf", names[n], &ns[n]) == 2)
+		n++;
+	fclose(fp);
+	return n;
+}
+
+int main(int argc, char **argv) {
+	char *basefile = NULL, *savefile = NULL;
+	char basenames[MAXKERNELS][64];
+	double basens[MAXKERNELS], ns[NUMKERNELS], rate, change;
+	double mintime = MINTIME, threshold = THRESHOLD;
+	int i, j, numbase = 0, regressions = 0;
+	FILE *fp;
+
+	for (i=1; i<argc; i++) {
+		if (strcmp(argv[i],"-b") == 0 && i+1 < argc)
+			basefile = argv[++i];
+		else if (strcmp(argv[i],"-s") == 0 && i+1 < argc)
+			savefile = argv[++i];
+		else if (strcmp(argv[i],"-r") == 0 && i+1 < argc)
+			threshold = atof(argv[++i]);
+		else if (strcmp(argv[i],"-t") == 0 && i+1 < argc)
+			mintime = atof(argv[++i]);
+		else {
+			fprintf(stderr,"Usage: %s [-b baseline] [-s savefile] [-r percent] [-t seconds]\n",argv[0]);
+			return 2;
+		}
+	}
+
+	if (basefile && (numbase = loadbaseline(basefile, basenames, basens)) < 0) {
+		fprintf(stderr,"Error: Could not read baseline \"%s\".\n",basefile);
+		return 2;
+	}
+
+	buildcorpus();
+	printf("%d positions from %d games\n\n", numpositions, CORPUSGAMES);
+	printf("%-20s %10s %14s%s\n", "kernel", "ns/call", "calls/s", basefile ? "   baseline  change" : "");
+
+	for (i=0; i<NUMKERNELS; i++) {
+		ns[i] = timekernel(i, mintime, &rate);
+		printf("%-20s %10.1f %14.0f", kernels[i].name, ns[i], rate);
+
+		for (j=0; j<numbase && strcmp(basenames[j], kernels[i].name) != 0; j++);
+		if (j < numbase) {
+			change = 100*(ns[i]-basens[j])/basens[j];
+			printf(" %10.1f %+6.1f%%", basens[j], change);
+			if (change > threshold) {
+				printf("  REGRESSION");
+				regressions++;
+			}
+		}
+		printf("\n");
+	}
+
+	if (savefile) {
+		if ((fp = fopen(savefile, "w")) == NULL) {
+			fprintf(stderr,"Error: Could not write \"%s\".\n",savefile);
+			return 2;
+		}
+		for (i=0; i<NUMKERNELS; i++)
+			fprintf(fp, "%s %.2f\n", kernels[i].name, ns[i]);
+		fclose(fp);
+	}
+
+	if (basefile)
+		printf("\n%d kernel%s slower than the baseline by more than %.1f%%\n",
+				regressions, regressions == 1 ? "" : "s", threshold);
+	return regressions ? 1 : 0;
+}
@@ -0,0 +1,158 @@
+#ifndef OTHELLO_H
+#define OTHELLO_H
+
+#include <stdint.h>
+
+/* The board is BOARDSIZE squares on a side: 8 unless the program is
+	built with -DBOARDSIZE=6 or -DBOARDSIZE=10. Everything below is a
+	compile-time constant, so each size gets code specialized for it. */
+#ifndef BOARDSIZE
+#define BOARDSIZE 8
+#endif
+#if BOARDSIZE != 6 && BOARDSIZE != 8 && BOARDSIZE != 10
+#error "BOARDSIZE must be 6, 8 or 10 (the sizes tables.h is generated for)"
+#endif
+
+// Numeric constants
+#define NUMTILES (BOARDSIZE*BOARDSIZE)
+#define MAXMOVES (NUMTILES/2)
+#define NUMDIAGS (2*BOARDSIZE-1)
+#define BOARDEND GETPOS(0,BOARDSIZE+1)	/* Size of the mailbox, 91 for 8x8 */
+#define ARRSIZE (2*BOARDEND+2*BOARDSIZE+2*NUMDIAGS+9)
+
+#define INF 2097152
+#define END 1048576
+#define NEAREND 1000000
+
+// Values representing pieces on board
+#define INVALID -INF
+#define EMPTY 0
+#define PLAYER1 1
+#define PLAYER2 -1
+#define OFFBOARD 2	/* Placeholder positions in getsquares() */
+
+// Macros related to stability
+#define ROWFILLED(b,n) (b[BOARDEND+4+(n)])
+#define COLFILLED(b,n) (b[BOARDEND+4+BOARDSIZE+(n)])
+#define DIAG1FILLED(b,n) (b[BOARDEND+4+2*BOARDSIZE+(n)])
+#define DIAG2FILLED(b,n) (b[BOARDEND+4+2*BOARDSIZE+NUMDIAGS+(n)])
+#define STABLE(b,n) (b[BOARDEND+4+2*BOARDSIZE+2*NUMDIAGS+(n)])
+#define P1NUMSTABLE(b) (b[ARRSIZE-5])
+#define TOTALNUMSTABLE(b) (b[ARRSIZE-4])
+
+// Running totals kept by makemove(), read by the heuristics in eval.c
+#define DISKSQUARE(b) (b[ARRSIZE-3])	/* h_disksquare() */
+#define FRONTIER(b) (b[ARRSIZE-2])		/* h_pmobility() */
+#define PARITY(b) (b[ARRSIZE-1])		/* Bit q set if quadrant q has an odd number of empty squares */
+
+// Other macros
+#define GETPLAYER(x) (((x)==PLAYER1)?1:2)
+#define GETPOS(x,y) (BOARDSIZE+2+(x)+(y)*(BOARDSIZE+1))
+#define GETDIAG1(pos) (GETX((pos))+GETY((pos)))
+#define GETDIAG2(pos) (BOARDSIZE-1-GETX((pos))+GETY((pos)))
+#define GETX(pos) (((pos)-BOARDSIZE-2)%(BOARDSIZE+1))
+#define GETY(pos) (((pos)-BOARDSIZE-2)/(BOARDSIZE+1))
+#define NOMOVES(lm) (lm[1] == -1)
+
+#define TURN(b) (b[BOARDEND])
+#define P1PIECES(b) (b[BOARDEND+1])
+#define ACTIVEPIECES(b) (b[BOARDEND+2])
+#define JUSTPLAYED(b) (b[BOARDEND+3])
+
+#define terminaltest(legalmoves,board) (NOMOVES(legalmoves) && oppskipcheck(board))
+
+/* Elements 0 to BOARDEND-1 of the board array represent the
+	board as follows (based on implementations by Gunnar Anderson,
+	Richard Delorme, etc), shown for 8x8:
+
+	p p p p p p p p p
+	p . . . . . . . .
+	p . . . . . . . .	p is a placeholder position (INVALID)
+	p . . . . . . . .	. is either PLAYER1, PLAYER2, or EMPTY
+	p . . . . . . . .
+	p . . . . . . . .
+	p . . . . . . . .
+	p . . . . . . . .
+	p . . . . . . . .
+	p p p p p p p p p p
+
+   The array also stores the following info about the game:
+	board[BOARDEND]   = Whose turn is it? (PLAYER1 or PLAYER2)
+	board[BOARDEND+1] = Number of PLAYER1 pieces
+	board[BOARDEND+2] = Total pieces on the board
+	board[BOARDEND+3] = The position of the piece that was just played
+
+	board[BOARDEND+4] and above relate to stability calculations,
+	and the last three elements hold running totals for the heuristics.
+	For 8x8 BOARDEND is 91 and ARRSIZE 237.
+*/
+
+// First and last squares of the board
+#define FIRSTSQ GETPOS(0,0)
+#define LASTSQ GETPOS(BOARDSIZE-1,BOARDSIZE-1)
+#define ISCORNER(pos) ((pos) == FIRSTSQ || (pos) == GETPOS(BOARDSIZE-1,0) \
+		|| (pos) == GETPOS(0,BOARDSIZE-1) || (pos) == LASTSQ)
+
+/* Use dirs[] to access elements directly
+	Northwest, North, Northeast, West, etc. */
+#define NW (-BOARDSIZE-2)
+#define N  (-BOARDSIZE-1)
+#define NE (-BOARDSIZE)
+#define  W -1
+#define  E  1
+#define SW  BOARDSIZE
+#define S   (BOARDSIZE+1)
+#define SE  (BOARDSIZE+2)
+
+/** Everything needed to take back a move made by makemove(). Kept
+	small so that a search can hold one per ply in its own memory. */
+struct undo {
+	int move;
+	int justplayed;
+	int p1numstable, totalnumstable;
+	int disksquare, frontier;
+	uint8_t nflipped, nstable;
+	uint8_t flipped[MAXMOVES];	/* Positions of the flipped pieces */
+	uint8_t stable[NUMTILES];	/* Positions of pieces that became stable */
+};
+
+extern const int dirs[8];
+
+// board.c
+void getmoves(int *board, int *legalmoves);
+int genmoves(int *board, uint8_t *moves);
+void getsquares(const int *board, int8_t *sq);
+int flipsquares(int8_t *sq, int move, int player);
+void results(int *board, int move, int *flipped);
+void makemove(int *board, int move, struct undo *u);
+void undomove(int *board, const struct undo *u);
+void unflip(int *board, int *flipped);
+int oppskipcheck(int *board);
+void init_stability(int *board);
+void init_totals(int *board);
+int updatestability(int *board, uint8_t *newstable);
+uint64_t hashboard(int *board);
+uint64_t hashupdate(uint64_t hash, int player, const struct undo *u);
+uint64_t hashmove(int *board, uint64_t hash, int move);
+void emptyboard(int *board);
+void defaultboard(int *board);
+int parseboard(const char *str, int *board);
+char *boardtostr(int *board, char *str);
+int loadboard(char *fname, int *board);
+int strtomove(const char *str);
+char *movetostr(int move, char *str);
+
+// eval.c
+int evaluation(int *board);
+int lazyevaluation(int *board, int nmoves, int lower, int upper);
+int h_diskdiff(int *board);
+int h_mobility(int *board);
+int h_pmobility(int *board);
+int h_disksquare(int *board);
+int h_edges(int *board);
+int h_stability(int *board);
+//int h_cornerstability(int *board);
+int h_topology(int *board);
+int h_parity(int *board);
+
+#endif
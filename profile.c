@@ -0,0 +1,82 @@
+#ifdef PROFILE
+
+#include <stdio.h>
+#include "profile.h"
+
+_Thread_local struct profile *prof_current;
+
+static const char *phasenames[PROF_NUMPHASES] = {
+	"timecheck", "tt", "genmoves", "oppskipcheck", "evaluation",
+	"ordering", "makemove", "updatestability", "undomove"
+};
+
+static FILE *tracefp;
+static int traceevents;
+
+void prof_merge(struct profile *to, const struct profile *from) {
+	int i;
+	for (i=0; i<PROF_NUMPHASES; i++) {
+		to->ticks[i] += from->ticks[i];
+		to->calls[i] += from->calls[i];
+	}
+}
+
+/** Print where the ticks of a search went. total is the number of
+	ticks the whole search took; the rest is the search's own work
+	(recursion, the move loop, hashing). makemove is shown without
+	the updatestability() call it makes. */
+void prof_table(FILE *fp, const struct profile *p, uint64_t total) {
+	uint64_t ticks, rest = total;
+	int i;
+
+	fprintf(fp, "%-16s %12s %14s %7s %10s\n", "phase", "calls", "ticks", "%", "ticks/call");
+	for (i=0; i<PROF_NUMPHASES; i++) {
+		ticks = p->ticks[i];
+		if (i == PROF_MAKEMOVE)
+			ticks -= p->ticks[PROF_STABILITY];
+		rest -= ticks;
+		fprintf(fp, "%-16s %12lu %14llu %6.1f%% %10.1f\n", phasenames[i], p->calls[i],
+				(unsigned long long)ticks, total ? 100.0*ticks/total : 0.0,
+				p->calls[i] ? (double)ticks/p->calls[i] : 0.0);
+	}
+	fprintf(fp, "%-16s %12s %14llu %6.1f%%\n", "other", "",
+			(unsigned long long)rest, total ? 100.0*rest/total : 0.0);
+	fprintf(fp, "%-16s %12s %14llu\n", "total", "", (unsigned long long)total);
+}
+
+/** Start writing Chrome trace events (chrome://tracing, Perfetto) to
+	a file. Returns 0, or -1 if it can't be created. */
+int prof_traceopen(const char *fname) {
+	if ((tracefp = fopen(fname, "w")) == NULL)
+		return -1;
+	fprintf(tracefp, "[\n");
+	traceevents = 0;
+	return 0;
+}
+
+/** Add a complete event spanning start to end (seconds since the
+	epoch), with the node count and the ticks spent in each phase
+	(makemove including updatestability). */
+void prof_trace(const char *name, double start, double end, unsigned long nodes, const struct profile *p) {
+	int i;
+
+	if (tracefp == NULL)
+		return;
+	fprintf(tracefp, "%s{\"name\":\"%s\",\"cat\":\"search\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+			"\"ts\":%.0f,\"dur\":%.0f,\"args\":{\"nodes\":%lu", traceevents++ ? ",\n" : "",
+			name, start*1e6, (end-start)*1e6, nodes);
+	for (i=0; p && i<PROF_NUMPHASES; i++)
+		fprintf(tracefp, ",\"%s\":%llu", phasenames[i], (unsigned long long)p->ticks[i]);
+	fprintf(tracefp, "}}");
+	fflush(tracefp);
+}
+
+void prof_traceclose(void) {
+	if (tracefp) {
+		fprintf(tracefp, "\n]\n");
+		fclose(tracefp);
+		tracefp = NULL;
+	}
+}
+
+#endif
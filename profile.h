@@ -0,0 +1,75 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+/* Optional instrumentation of the search. Compiled in only with
+	-DPROFILE (which needs GCC or Clang); otherwise PROF() and
+	PROF_VOID() are just the code they wrap and cost nothing.
+
+	Wrapped calls add the time they take, in CPU ticks, to the phase
+	they belong to in the profile of the current thread, which the
+	engine points at the profile of the iteration it is running. */
+
+// Phases of the search
+enum {
+	PROF_TIMECHECK,		/* outoftime() */
+	PROF_TT,			/* Transposition table probes and stores */
+	PROF_GENMOVES,
+	PROF_OPPSKIP,		/* oppskipcheck() */
+	PROF_EVALUATION,
+	PROF_ORDERING,
+	PROF_MAKEMOVE,		/* Includes PROF_STABILITY */
+	PROF_STABILITY,		/* updatestability() */
+	PROF_UNDOMOVE,
+	PROF_NUMPHASES
+};
+
+struct profile {
+	uint64_t ticks[PROF_NUMPHASES];
+	unsigned long calls[PROF_NUMPHASES];
+};
+
+#ifdef PROFILE
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define prof_ticks() __rdtsc()
+#else
+#include <time.h>
+static inline uint64_t prof_ticks(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+#endif
+
+extern _Thread_local struct profile *prof_current;
+
+static inline void prof_add(int phase, uint64_t start) {
+	if (prof_current) {
+		prof_current->ticks[phase] += prof_ticks()-start;
+		prof_current->calls[phase]++;
+	}
+}
+
+#define PROF(phase, expr) ({ uint64_t prof_t = prof_ticks(); \
+	__typeof__(expr) prof_r = (expr); prof_add(phase, prof_t); prof_r; })
+#define PROF_VOID(phase, stmt) do { uint64_t prof_t = prof_ticks(); \
+	stmt; prof_add(phase, prof_t); } while (0)
+
+void prof_merge(struct profile *to, const struct profile *from);
+void prof_table(FILE *fp, const struct profile *p, uint64_t total);
+int prof_traceopen(const char *fname);
+void prof_trace(const char *name, double start, double end, unsigned long nodes, const struct profile *p);
+void prof_traceclose(void);
+
+#else
+
+#define PROF(phase, expr) (expr)
+#define PROF_VOID(phase, stmt) stmt
+
+#endif
+
+#endif
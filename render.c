@@ -0,0 +1,184 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <unistd.h>
+#include "othello.h"
+#include "render.h"
+
+void render_init(struct display *d, int level, int options) {
+	d->level = level;
+	d->options = options;
+	d->len = 0;
+}
+
+/** Convert a string of option letters to SHOW_* flags: t(all),
+	r(ecent), f(lipped), l(ist of moves on the side), m(oves on the
+	board), e(valuation). Returns -1 for an unknown letter. */
+int render_parseoptions(const char *str) {
+	const char *letters = "trflme", *p;
+	int options = 0;
+
+	for (; *str; str++) {
+		if ((p = strchr(letters,*str)) == NULL)
+			return -1;
+		options |= 1<<(p-letters);
+	}
+	return options;
+}
+
+/** Append a string to the buffer. */
+static void put(struct display *d, const char *str) {
+	size_t n = strlen(str);
+	if (n > sizeof d->buf - d->len)
+		n = sizeof d->buf - d->len;
+	memcpy(d->buf + d->len, str, n);
+	d->len += n;
+}
+
+/** Append a string repeated n times. */
+static void putn(struct display *d, const char *str, int n) {
+	while (n-- > 0)
+		put(d, str);
+}
+
+void render_printf(struct display *d, const char *fmt, ...) {
+	va_list ap;
+	int n;
+
+	va_start(ap, fmt);
+	n = vsnprintf(d->buf + d->len, sizeof d->buf - d->len, fmt, ap);
+	va_end(ap);
+	if (n > 0)
+		d->len += ((size_t)n < sizeof d->buf - d->len) ? (size_t)n : sizeof d->buf - d->len - 1;
+}
+
+/** Write out everything in the buffer. Anything printed with stdio
+	is flushed first so the output stays in order. */
+void render_flush(struct display *d) {
+	size_t n;
+	ssize_t w;
+
+	fflush(stdout);
+	for (n=0; n<d->len; n+=w)
+		if ((w = write(STDOUT_FILENO, d->buf+n, d->len-n)) <= 0)
+			break;
+	d->len = 0;
+}
+
+/** Draw the board with ANSI colors. */
+static void drawboard(struct display *d, int *board, int *legalmoves, int *flipped) {
+	uint8_t movenum[BOARDEND] = {0}, isflipped[BOARDEND] = {0};
+	int i, j, pos, player = TURN(board);
+	int opt = d->options;
+
+	if ((opt & SHOW_MOVESONBOARD) && legalmoves[1] != -1)
+		for (i=1; i<=legalmoves[0]; i++)
+			movenum[legalmoves[i]] = i;
+
+	if (opt & SHOW_FLIPPED)
+		for (i=0; flipped[i]>=FIRSTSQ; i++)
+			isflipped[flipped[i]] = 1;
+
+	// Column labels at the top (A->H)
+	put(d, "  ");
+	for (i=0; i<BOARDSIZE; i++)
+		render_printf(d, "   %c  ", 'A'+i);
+
+	put(d, "\n");
+	for (i=0; i<BOARDSIZE; i++) {
+		put(d, "  ");
+		putn(d, "+-----", BOARDSIZE);
+		put(d, "+\n  ");
+
+		/* If SHOW_FLIPPED is set, label pieces that have
+			just been flipped by placing a dot above it. 	*/
+		for (j=0; j<BOARDSIZE; j++) {
+			pos = GETPOS(j,i);
+			if (!(opt & SHOW_FLIPPED) || board[pos] == EMPTY
+					|| (!isflipped[pos] && pos != JUSTPLAYED(board)))
+				put(d, "|     ");
+			else
+				render_printf(d, "|  %s.%s  ", board[pos]==PLAYER1?COL_PLAYER1:COL_PLAYER2, COL_EMPTY);
+		}
+
+		// Row labels at the left (1-8)
+		render_printf(d, "|\n%-2d", i+1);
+
+		/* Display the pieces on the board, as well as any legal moves and the
+			corresponding move number. If SHOW_RECENT is set, the most recently-
+			played piece will have a colored background. 	*/
+		for (j=0; j<BOARDSIZE; j++) {
+			pos = GETPOS(j,i);
+			if (board[pos] == PLAYER1)
+				render_printf(d, "|  %s%c%s  ", ((opt & SHOW_RECENT) && pos == JUSTPLAYED(board))
+						? COL_PLAYER1_RECENT : COL_PLAYER1, CHR_PLAYER1, COL_EMPTY);
+			else if (board[pos] == PLAYER2)
+				render_printf(d, "|  %s%c%s  ", ((opt & SHOW_RECENT) && pos == JUSTPLAYED(board))
+						? COL_PLAYER2_RECENT : COL_PLAYER2, CHR_PLAYER2, COL_EMPTY);
+			else if (movenum[pos]) // Show move numbers
+				render_printf(d, "| %s%2d%s  ", COL_MOVE, movenum[pos], COL_EMPTY);
+			else
+				put(d, "|     ");
+		}
+		put(d, "|\n");
+
+		if (opt & SHOW_TALL) { // Board takes up more vertical space
+			put(d, "  ");
+			putn(d, "|     ", BOARDSIZE);
+			put(d, "|\n");
+		}
+	}
+	put(d, "  ");
+	putn(d, "+-----", BOARDSIZE);
+	put(d, "+\n");
+
+	if (opt & SHOW_MOVESONSIDE) {
+		// A ton of escape sequences to get the list to appear on the right of the board
+		render_printf(d, "\033[s\033[%dC\033[%dA", 5+6*BOARDSIZE, ((opt & SHOW_TALL) ? 4 : 3)*BOARDSIZE);
+		render_printf(d, "P%d (%s%c%s)'s turn\033[B\033[12D", GETPLAYER(player),
+				player==PLAYER1?COL_PLAYER1:COL_PLAYER2, player==PLAYER1?CHR_PLAYER1:CHR_PLAYER2, COL_EMPTY);
+
+		// List of legal moves
+		put(d, "\033[D\033[BMoves:\033[B\033[7D");
+		if (legalmoves[1] == -1)
+			put(d, "  None");
+		else {
+			for (i=1; i<=legalmoves[0]; i++)
+				render_printf(d, "%s%3d%s. %c%d\033[B\033[7D", COL_MOVE, i, COL_EMPTY,
+						'A'+GETX(legalmoves[i]), 1+GETY(legalmoves[i]));
+		}
+
+		put(d, "\033[u");
+	}
+
+	if (opt & SHOW_EVAL)
+		render_printf(d, "Evaluation of this board: %d\n", player*evaluation(board));
+
+	if (!(opt & SHOW_MOVESONSIDE) && !terminaltest(legalmoves,board))
+		render_printf(d, "P%d (%s%c%s)'s turn. ", GETPLAYER(player),
+				player==PLAYER1?COL_PLAYER1:COL_PLAYER2, player==PLAYER1?CHR_PLAYER1:CHR_PLAYER2, COL_EMPTY);
+
+	// Number of PLAYER1 pieces and PLAYER2 pieces
+	render_printf(d, "Score: [ P1 (%s%c%s): %d / P2 (%s%c%s): %d ]\n",
+			COL_PLAYER1, CHR_PLAYER1, COL_EMPTY, P1PIECES(board),
+			COL_PLAYER2, CHR_PLAYER2, COL_EMPTY, ACTIVEPIECES(board)-P1PIECES(board));
+}
+
+/** Output the current position according to the output level,
+	as a single write. */
+void render_board(struct display *d, int *board, int *legalmoves, int *flipped) {
+	char str[NUMTILES+2];
+
+	switch (d->level) {
+	case OUTPUT_FULL:
+		drawboard(d, board, legalmoves, flipped);
+		break;
+	case OUTPUT_COMPACT:
+		render_printf(d, "%s %d-%d\n", boardtostr(board,str),
+				P1PIECES(board), ACTIVEPIECES(board)-P1PIECES(board));
+		break;
+	default:
+		return;
+	}
+	render_flush(d);
+}
@@ -0,0 +1,56 @@
+#ifndef RENDER_H
+#define RENDER_H
+
+#include <stddef.h>
+
+// Characters representing pieces on board
+#define CHR_PLAYER1 '*'
+#define CHR_PLAYER2 '-'
+#define CHR_EMPTY ' '
+
+// Color codes
+#define COL_PLAYER1 "\033[0m\033[1;36m"
+#define COL_PLAYER2 "\033[0m\033[1;32m"
+#define COL_EMPTY "\033[0m"
+#define COL_PLAYER1_RECENT "\033[1;36;46m"
+#define COL_PLAYER2_RECENT "\033[1;32;42m"
+#define COL_MOVE "\033[1;33m"
+
+// Output levels
+#define OUTPUT_SILENT 0		/* Nothing but the outcome of each game */
+#define OUTPUT_COMPACT 1	/* One line per position */
+#define OUTPUT_FULL 2		/* The board drawn with ANSI colors */
+
+// Display options for OUTPUT_FULL
+#define SHOW_TALL 1			/* Make the board take up more 
+								vertical space on the display */
+#define SHOW_RECENT 2		/* Mark the most recent move on the 
+								board with a colored background */
+#define SHOW_FLIPPED 4		/* Mark the recently-flipped pieces 
+								on the board with a dot */
+#define SHOW_MOVESONSIDE 8	/* List legal moves on the right (messes up if 
+								the entire board doesn't fit in the window) */
+#define SHOW_MOVESONBOARD 16	/* Show legal moves on the board itself, 
+								in the corresponding position */
+#define SHOW_EVAL 32		/* Print eval-function's output from the perspective 
+								of the current player on each turn */
+
+#define SHOW_DEFAULT (SHOW_RECENT|SHOW_FLIPPED|SHOW_MOVESONSIDE|SHOW_MOVESONBOARD|SHOW_EVAL)
+
+#define RENDERBUFSIZE 16384
+
+/** Output is built up in buf and written out with a single write(). */
+struct display {
+	int level;
+	int options;
+	size_t len;
+	char buf[RENDERBUFSIZE];
+};
+
+void render_init(struct display *d, int level, int options);
+int render_parseoptions(const char *str);
+void render_printf(struct display *d, const char *fmt, ...);
+void render_flush(struct display *d);
+void render_board(struct display *d, int *board, int *legalmoves, int *flipped);
+
+#endif
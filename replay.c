@@ -0,0 +1,144 @@
+#include <ctype.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include "replay.h"
+
+/* Games are written as a list of moves such as "f5d6c3d3c4", played
+	from the standard starting position, optionally preceded by a
+	starting board in the format read by parseboard(). Passes are
+	played whenever the side to move has no legal move, so they can be
+	left out; "pass" or "PA" is also accepted where one happens. Spaces
+	and punctuation between moves are ignored. */
+
+/** Replay a game into board, calling visit (if not NULL) for every
+	position before its move is played and for the final position.
+	Returns the number of moves played, not counting passes, or -1 if
+	the string holds something other than a legal move. board is then
+	the position where the game stopped. */
+int replay(const char *game, int *board, replayfn visit, void *arg) {
+	int legalmoves[MAXMOVES], flipped[MAXMOVES];
+	const char *p = game;
+	int i, move, n = 0;
+
+	while (isspace((unsigned char)*p))
+		p++;
+	if (*p >= '0' && *p <= '2') {
+		if ((i = parseboard(p, board)) < 0)
+			return -1;
+		p += i;
+	}
+	else
+		defaultboard(board);
+
+	for (;;) {
+		while (*p && !isalpha((unsigned char)*p))
+			p++;
+		getmoves(board, legalmoves);
+
+		if (*p == '\0')
+			break;
+		if (NOMOVES(legalmoves)) {
+			if (oppskipcheck(board))
+				return -1;	/* Moves after the end of the game */
+			if (visit)
+				visit(board, -1, arg);
+			results(board, -1, flipped);
+			if (strncmp(p, "pass", 4) == 0 || strncmp(p, "PA", 2) == 0)
+				p += p[1] == 'A' ? 2 : 4;
+			continue;
+		}
+
+		if ((move = strtomove(p)) <= 0)
+			return -1;
+		for (i=1; legalmoves[i] != move; i++)
+			if (i == legalmoves[0])
+				return -1;
+		for (p++; isdigit((unsigned char)*p); p++);
+
+		if (visit)
+			visit(board, move, arg);
+		results(board, move, flipped);
+		n++;
+	}
+
+	if (visit)
+		visit(board, 0, arg);
+	return n;
+}
+
+/* Every position of a game, with its move, as written by replay_run().
+	A game holds at most a move and a pass per square. */
+#define LINELEN (NUMTILES+8)
+struct stream {
+	char buf[(2*NUMTILES+1)*LINELEN];
+	char *end;
+	unsigned long positions;
+};
+
+static void addposition(int *board, int move, void *arg) {
+	struct stream *s = arg;
+
+	boardtostr(board, s->end);
+	s->end += NUMTILES+1;
+	if (move) {
+		*s->end++ = ' ';
+		s->end += strlen(movetostr(move, s->end));
+	}
+	*s->end++ = '\n';
+	s->positions++;
+}
+
+/** Replay every game in a file ("-" for stdin), one per line, and
+	write each position on stdout in the format read by parseboard(),
+	followed by the move played from it (none after the last move).
+	The output can be fed straight to batch_run(). Games that can't be
+	replayed are reported and skipped. Returns 0, or -1 if the file
+	couldn't be read. */
+int replay_run(const char *fname) {
+	static struct stream s;
+	char buf[4096];
+	int board[ARRSIZE];
+	int line = 0, games = 0, bad = 0;
+	unsigned long positions = 0;
+	FILE *fp = stdin;
+
+	if (strcmp(fname, "-") != 0 && (fp = fopen(fname,"r")) == NULL) {
+		fprintf(stderr,"Error: Could not open file \"%s\" for reading: %s\n",fname,strerror(errno));
+		return -1;
+	}
+	while (fgets(buf, sizeof buf, fp)) {
+		line++;
+		if (strspn(buf, " \t\r\n") == strlen(buf))
+			continue;
+		// Nothing is written unless the whole game is legal
+		s.end = s.buf;
+		s.positions = 0;
+		if (replay(buf, board, addposition, &s) < 0) {
+			fprintf(stderr,"Warning: Line %d of \"%s\" is not a legal game.\n",line,fname);
+			bad++;
+			continue;
+		}
+		fwrite(s.buf, 1, s.end-s.buf, stdout);
+		positions += s.positions;
+		games++;
+	}
+	if (fp != stdin)
+		fclose(fp);
+
+	fprintf(stderr,"%d games  %lu positions  %d skipped\n",games,positions,bad);
+	return 0;
+}
+
+/** Append a game to a file as one line. Returns 0, or -1 on error. */
+int replay_save(const char *fname, const char *game) {
+	FILE *fp;
+	int ok;
+
+	if ((fp = fopen(fname,"a")) == NULL)
+		return -1;
+	ok = fprintf(fp,"%s\n",game) >= 0;
+	if (fclose(fp) != 0)
+		ok = 0;
+	return ok ? 0 : -1;
+}
@@ -0,0 +1,18 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "othello.h"
+
+/* Longest game string: a starting board, a space and up to three
+	characters for each move */
+#define GAMELEN (NUMTILES+3+3*NUMTILES)
+
+/** Called for every position of a replayed game with the move played
+	from it: a position, -1 for a pass, or 0 after the last move. */
+typedef void (*replayfn)(int *board, int move, void *arg);
+
+int replay(const char *game, int *board, replayfn visit, void *arg);
+int replay_run(const char *fname);
+int replay_save(const char *fname, const char *game);
+
+#endif
@@ -0,0 +1,523 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "engine.h"
+#include "server.h"
+
+/* Server mode plays any number of games in one process. Requests are
+	lines of the form "<game> <command> [argument]" read from stdin or
+	from clients of a local socket, and every reply is a single line
+	starting with the name of the game it refers to:
+
+		<game> new					Start a game from the initial position
+		<game> setboard <board>		Set the position (parseboard() format)
+		<game> play <move>			Play a move such as f5, or pass
+		<game> time <seconds>		Limits for this game's searches
+		<game> depth <n>
+		<game> nodes <n>
+		<game> seed <n>				Seed for breaking ties between moves
+		<game> memory [megabytes]	Cap the memory of the game's engine,
+									replies "<game> memory <bytes used>"
+		<game> engine <alphabeta|mcts> [threads]
+									Choose the search algorithm
+		<game> param <name> <value>	Tune the search (struct searchparams)
+		<game> go					Search for a move, replies with
+									"<game> bestmove <move> score <n> ..."
+		<game> analyze [k]			Score every move, exactly for the best k,
+									replies "<game> analysis depth <n> f5 12
+									d6 10 c3 <=4 ..." (best first)
+		<game> stop					Make the current search reply now
+		<game> extend [seconds]		Give the current search more time, or
+									with no argument, no time limit
+		<game> info <on|off>		While searching, send "<game> info depth
+									<n> score <n> move <move> nodes <n> nps
+									<n> time <t> pv ..." after every iteration
+		<game> board				Reply with the position
+		<game> free					End the game
+		quit						Close the connection
+
+	Other replies are "<game> ok" and "<game> error <message>".
+
+	Searches of all games are run by a shared pool of worker threads.
+	Games take turns one iterative-deepening iteration at a time, so
+	a long search can't hold up the others. Each game only owns its
+	board and engine; the move ordering and evaluation tables are
+	read-only and shared by all of them. */
+
+struct connection {
+	int in, out;
+	pthread_mutex_t lock;		/* Serializes replies */
+	struct session *sessions;
+};
+
+struct session {
+	char name[64];
+	struct connection *conn;
+	struct engine *e;
+	int board[ARRSIZE];
+	struct searchlimits limits;
+	struct searchresult result;
+	int multipv;				/* Current search is an analysis */
+	int info;					/* Report every iteration */
+	int searching;				/* Queued or being searched (guarded by pool.lock) */
+	struct session *next;		/* Next game on the same connection */
+	struct session *qnext;		/* Next game in the run queue */
+};
+
+static struct {
+	pthread_mutex_t lock;
+	pthread_cond_t work;		/* Signalled when a game is queued */
+	pthread_cond_t idle;		/* Signalled when a search finishes */
+	struct session *head, *tail;
+} pool = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.work = PTHREAD_COND_INITIALIZER,
+	.idle = PTHREAD_COND_INITIALIZER
+};
+
+static struct ecache *ecache;	/* Solved endgames, shared by every game */
+
+#define REPLYSIZE 4096
+
+/** Format a reply line into buf, which holds REPLYSIZE bytes, adding
+	the newline. Returns its length. */
+static size_t vformat(char *buf, const char *fmt, va_list ap) {
+	size_t len = vsnprintf(buf, REPLYSIZE-1, fmt, ap);
+	if (len > REPLYSIZE-2)
+		len = REPLYSIZE-2;
+	buf[len++] = '\n';
+	return len;
+}
+
+static size_t format(char *buf, const char *fmt, ...) {
+	va_list ap;
+	size_t len;
+
+	va_start(ap, fmt);
+	len = vformat(buf, fmt, ap);
+	va_end(ap);
+	return len;
+}
+
+/** Write a line to the client. Called with c->lock held. */
+static void sendline(struct connection *c, const char *buf, size_t len) {
+	size_t n;
+	ssize_t w;
+
+	for (n=0; n<len; n+=w)
+		if ((w = write(c->out, buf+n, len-n)) <= 0)
+			break;
+}
+
+/** Send a formatted line to the client. */
+static void reply(struct connection *c, const char *fmt, ...) {
+	char buf[REPLYSIZE];
+	va_list ap;
+	size_t len;
+
+	va_start(ap, fmt);
+	len = vformat(buf, fmt, ap);
+	va_end(ap);
+
+	pthread_mutex_lock(&c->lock);
+	sendline(c, buf, len);
+	pthread_mutex_unlock(&c->lock);
+}
+
+/** Format the outcome of a finished search into buf (see vformat()). */
+static size_t formatbestmove(struct session *s, char *buf) {
+	struct searchresult *r = &s->result;
+	char pv[MAXPLY*5+1], *p = pv;
+	int i;
+
+	*p = '\0';
+	for (i=0; i<r->pvlength; i++) {
+		*p++ = ' ';
+		p += strlen(movetostr(r->pv[i], p));
+	}
+	return format(buf, "%s bestmove %s score %d depth %d nodes %lu time %.3f "
+		"reduced %lu researched %lu extended %lu pv%s",
+		s->name, movetostr(r->move, (char[8]){0}), r->score, r->depth, r->nodes, r->time,
+		r->reductions, r->researches, r->extensions, pv);
+}
+
+/** Report the progress of a search after an iteration. */
+static void replyinfo(struct session *s) {
+	struct searchresult *r = &s->result;
+	char buf[MAXPLY*5+1], *p = buf;
+	int i;
+
+	*p = '\0';
+	for (i=0; i<r->pvlength; i++) {
+		*p++ = ' ';
+		p += strlen(movetostr(r->pv[i], p));
+	}
+	reply(s->conn, "%s info depth %d score %d move %s nodes %lu nps %.0f time %.3f pv%s",
+		s->name, r->depth, r->score, movetostr(r->move, (char[8]){0}), r->nodes,
+		r->time > 0 ? r->nodes/r->time : 0.0, r->time, buf);
+}
+
+/** Format the scores of all moves after an analysis into buf (see
+	vformat()). */
+static size_t formatanalysis(struct session *s, char *buf) {
+	struct searchresult *r = &s->result;
+	char moves[MAXMOVES*24+1], *p = moves;
+	int i;
+
+	*p = '\0';
+	for (i=0; i<r->nummoves; i++) {
+		*p++ = ' ';
+		p += strlen(movetostr(r->moves[i].move, p));
+		p += sprintf(p, " %s%d", r->moves[i].bound == TT_EXACT ? "" : "<=", r->moves[i].score);
+	}
+	return format(buf, "%s analysis depth %d nodes %lu time %.3f%s",
+		s->name, r->depth, r->nodes, r->time, moves);
+}
+
+/** Add a game to the end of the run queue. Called with pool.lock held. */
+static void enqueue(struct session *s) {
+	s->qnext = NULL;
+	if (pool.tail)
+		pool.tail->qnext = s;
+	else
+		pool.head = s;
+	pool.tail = s;
+	pthread_cond_signal(&pool.work);
+}
+
+/** Worker threads repeatedly take the game at the front of the run
+	queue, search one more iteration and requeue it if unfinished. */
+static void *worker(void *arg) {
+	struct session *s;
+	struct connection *c;
+	char buf[REPLYSIZE];
+	size_t len;
+
+	pthread_mutex_lock(&pool.lock);
+	for (;;) {
+		while ((s = pool.head) == NULL)
+			pthread_cond_wait(&pool.work, &pool.lock);
+		if ((pool.head = s->qnext) == NULL)
+			pool.tail = NULL;
+		pthread_mutex_unlock(&pool.lock);
+
+		if (engine_iterate(s->e, &s->result)) {
+			if (s->info)
+				replyinfo(s);
+			pthread_mutex_lock(&pool.lock);
+			enqueue(s);
+			continue;
+		}
+
+		/* The game stops being busy before its reply is sent, so that
+			the client can follow up on the reply at once, and may then
+			be searched again or freed: the reply is formatted first, and
+			the connection's lock keeps anything else from being sent
+			ahead of it. pool.lock isn't held while writing, or a client
+			that stops reading would hold up every game. */
+		c = s->conn;
+		len = s->multipv ? formatanalysis(s, buf) : formatbestmove(s, buf);
+		pthread_mutex_lock(&c->lock);
+		pthread_mutex_lock(&pool.lock);
+		s->searching = 0;
+		pthread_cond_broadcast(&pool.idle);
+		pthread_mutex_unlock(&pool.lock);
+		sendline(c, buf, len);
+		pthread_mutex_unlock(&c->lock);
+		pthread_mutex_lock(&pool.lock);
+	}
+	return arg;
+}
+
+static struct session *findsession(struct connection *c, const char *name) {
+	struct session *s;
+	for (s=c->sessions; s; s=s->next)
+		if (strcmp(s->name, name) == 0)
+			return s;
+	return NULL;
+}
+
+/** Stop the game's search, wait for it to finish, and free it. */
+static void freesession(struct connection *c, struct session *s) {
+	struct session **p;
+
+	pthread_mutex_lock(&pool.lock);
+	if (s->searching)
+		engine_stop(s->e);
+	while (s->searching)
+		pthread_cond_wait(&pool.idle, &pool.lock);
+	pthread_mutex_unlock(&pool.lock);
+
+	for (p=&c->sessions; *p!=s; p=&(*p)->next);
+	*p = s->next;
+	engine_destroy(s->e);
+	free(s);
+}
+
+static int issearching(struct session *s) {
+	int searching;
+	pthread_mutex_lock(&pool.lock);
+	searching = s->searching;
+	pthread_mutex_unlock(&pool.lock);
+	return searching;
+}
+
+/** Handle one request line. Returns -1 if the connection should close. */
+static int command(struct connection *c, char *line) {
+	char *name, *cmd, *arg, *save;
+	int legalmoves[MAXMOVES], flipped[MAXMOVES];
+	int i, move, tmpboard[ARRSIZE];
+	struct session *s;
+
+	if ((name = strtok_r(line, " \t\r\n", &save)) == NULL)
+		return 0;
+	if (strcmp(name, "quit") == 0)
+		return -1;
+	if ((cmd = strtok_r(NULL, " \t\r\n", &save)) == NULL) {
+		reply(c, "%s error missing command", name);
+		return 0;
+	}
+	arg = strtok_r(NULL, " \t\r\n", &save);
+	s = findsession(c, name);
+
+	if (strcmp(cmd, "new") == 0) {
+		if (s == NULL) {
+			if (strlen(name) >= sizeof s->name || (s = calloc(1, sizeof *s)) == NULL) {
+				reply(c, "%s error could not create game", name);
+				return 0;
+			}
+			if ((s->e = engine_create()) == NULL) {
+				free(s);
+				reply(c, "%s error could not create game", name);
+				return 0;
+			}
+			engine_setecache(s->e, ecache);
+			strcpy(s->name, name);
+			s->conn = c;
+			s->limits.time = 1.0;
+			s->next = c->sessions;
+			c->sessions = s;
+		}
+		else if (issearching(s)) {
+			reply(c, "%s error busy", name);
+			return 0;
+		}
+		defaultboard(s->board);
+		engine_newgame(s->e);
+		reply(c, "%s ok", name);
+		return 0;
+	}
+
+	if (s == NULL) {
+		reply(c, "%s error unknown game", name);
+		return 0;
+	}
+
+	if (strcmp(cmd, "stop") == 0) {
+		pthread_mutex_lock(&pool.lock);
+		if ((i = s->searching))
+			engine_stop(s->e);
+		pthread_mutex_unlock(&pool.lock);
+		if (!i)		// Otherwise the worker sends the bestmove reply
+			reply(c, "%s ok", name);
+		return 0;
+	}
+	if (strcmp(cmd, "extend") == 0) {
+		pthread_mutex_lock(&pool.lock);
+		if (s->searching)
+			engine_extend(s->e, arg ? atof(arg) : 0);
+		pthread_mutex_unlock(&pool.lock);
+		reply(c, "%s ok", name);
+		return 0;
+	}
+	if (strcmp(cmd, "free") == 0) {
+		freesession(c, s);
+		reply(c, "%s ok", name);
+		return 0;
+	}
+	if (issearching(s)) {
+		reply(c, "%s error busy", name);
+		return 0;
+	}
+
+	if (strcmp(cmd, "setboard") == 0) {
+		if (arg == NULL || parseboard(arg, tmpboard) < 0) {
+			reply(c, "%s error bad board", name);
+			return 0;
+		}
+		memcpy(s->board, tmpboard, sizeof tmpboard);
+		engine_newgame(s->e);
+	}
+	else if (strcmp(cmd, "play") == 0) {
+		getmoves(s->board, legalmoves);
+		move = arg ? strtomove(arg) : 0;
+		for (i=1; i<=legalmoves[0] && legalmoves[i]!=move; i++);
+		if (move == 0 || i > legalmoves[0]) {
+			reply(c, "%s error illegal move", name);
+			return 0;
+		}
+		results(s->board, move, flipped);
+	}
+	else if (strcmp(cmd, "time") == 0 && arg)
+		s->limits.time = atof(arg);
+	else if (strcmp(cmd, "depth") == 0 && arg)
+		s->limits.depth = atoi(arg);
+	else if (strcmp(cmd, "nodes") == 0 && arg)
+		s->limits.nodes = strtoul(arg, NULL, 10);
+	else if (strcmp(cmd, "info") == 0 && arg)
+		s->info = strcmp(arg, "on") == 0;
+	else if (strcmp(cmd, "seed") == 0 && arg)
+		engine_setseed(s->e, strtoul(arg, NULL, 10));
+	else if (strcmp(cmd, "engine") == 0 && arg) {
+		char *threads = strtok_r(NULL, " \t\r\n", &save);
+		int mode = strcmp(arg, "mcts") == 0 ? ENGINE_MCTS : strcmp(arg, "alphabeta") == 0 ? ENGINE_ALPHABETA : -1;
+		if (mode < 0 || engine_setmode(s->e, mode, threads ? atoi(threads) : 1) < 0) {
+			reply(c, "%s error bad engine", name);
+			return 0;
+		}
+	}
+	else if (strcmp(cmd, "param") == 0 && arg) {
+		char *value = strtok_r(NULL, " \t\r\n", &save);
+		if (value == NULL || engine_setparam(s->e, arg, atoi(value)) < 0) {
+			reply(c, "%s error bad parameter", name);
+			return 0;
+		}
+	}
+	else if (strcmp(cmd, "memory") == 0) {
+		if (arg && engine_setmemory(s->e, (size_t)strtoul(arg, NULL, 10) << 20) < 0) {
+			reply(c, "%s error not enough memory", name);
+			return 0;
+		}
+		reply(c, "%s memory %zu", name, engine_memory(s->e, NULL));
+		return 0;
+	}
+	else if (strcmp(cmd, "board") == 0) {
+		char buf[NUMTILES+2];
+		reply(c, "%s board %s", name, boardtostr(s->board, buf));
+		return 0;
+	}
+	else if (strcmp(cmd, "go") == 0 || strcmp(cmd, "analyze") == 0) {
+		struct searchlimits limits = s->limits;
+		if (strcmp(cmd, "go") == 0)
+			limits.multipv = 0;
+		else if ((limits.multipv = arg ? atoi(arg) : 0) <= 0)
+			limits.multipv = MAXMOVES;
+		s->multipv = limits.multipv;
+		engine_setposition(s->e, s->board);
+		engine_setlimits(s->e, &limits);
+		engine_begin(s->e, &s->result);
+		pthread_mutex_lock(&pool.lock);
+		s->searching = 1;
+		enqueue(s);
+		pthread_mutex_unlock(&pool.lock);
+		return 0;
+	}
+	else {
+		reply(c, "%s error unknown command", name);
+		return 0;
+	}
+
+	reply(c, "%s ok", name);
+	return 0;
+}
+
+/** Read requests from a connection until it closes. */
+static void serve(struct connection *c) {
+	char line[1024];
+	FILE *fp;
+	int fd;
+
+	if ((fd = dup(c->in)) < 0 || (fp = fdopen(fd, "r")) == NULL)
+		return;
+	while (fgets(line, sizeof line, fp))
+		if (command(c, line) < 0)
+			break;
+	fclose(fp);
+
+	while (c->sessions)
+		freesession(c, c->sessions);
+}
+
+static void *connectionthread(void *arg) {
+	struct connection *c = arg;
+
+	serve(c);
+	// Wait for a worker still sending a game's last reply
+	pthread_mutex_lock(&c->lock);
+	pthread_mutex_unlock(&c->lock);
+	close(c->in);
+	pthread_mutex_destroy(&c->lock);
+	free(c);
+	return NULL;
+}
+
+/** Run the server with nthreads search threads, reading requests
+	from stdin or, if sockpath isn't NULL, from clients connecting to
+	a Unix domain socket at sockpath. */
+int server_run(const char *sockpath, int nthreads) {
+	struct sockaddr_un addr;
+	struct connection *c, stdio = { 0, 1, PTHREAD_MUTEX_INITIALIZER, NULL };
+	pthread_t thread;
+	int i, fd, client;
+
+	// A client that goes away mid-reply must not take the server with it
+	signal(SIGPIPE, SIG_IGN);
+	if ((ecache = ec_create(EC_DEFAULTSIZE)) == NULL) {
+		fprintf(stderr,"Error: Could not allocate the endgame cache.\n");
+		return -1;
+	}
+	for (i=0; i<nthreads; i++) {
+		if (pthread_create(&thread, NULL, worker, NULL) != 0) {
+			fprintf(stderr,"Error: Could not start worker thread: %s\n",strerror(errno));
+			return -1;
+		}
+		pthread_detach(thread);
+	}
+
+	if (sockpath == NULL) {
+		serve(&stdio);
+		return 0;
+	}
+
+	memset(&addr, 0, sizeof addr);
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, sockpath, sizeof addr.sun_path-1);
+	unlink(sockpath);
+	if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0
+			|| bind(fd, (struct sockaddr *)&addr, sizeof addr) < 0
+			|| listen(fd, 64) < 0) {
+		fprintf(stderr,"Error: Could not listen on \"%s\": %s\n",sockpath,strerror(errno));
+		return -1;
+	}
+
+	for (;;) {
+		if ((client = accept(fd, NULL, NULL)) < 0) {
+			if (errno == EINTR)
+				continue;
+			fprintf(stderr,"Error: accept() failed: %s\n",strerror(errno));
+			break;
+		}
+		if ((c = calloc(1, sizeof *c)) == NULL) {
+			close(client);
+			continue;
+		}
+		c->in = c->out = client;
+		pthread_mutex_init(&c->lock, NULL);
+		if (pthread_create(&thread, NULL, connectionthread, c) != 0) {
+			close(client);
+			free(c);
+			continue;
+		}
+		pthread_detach(thread);
+	}
+
+	close(fd);
+	return -1;
+}
@@ -0,0 +1,8 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#define SERVER_THREADS 4	/* Default size of the worker pool */
+
+int server_run(const char *sockpath, int nthreads);
+
+#endif
@@ -0,0 +1,443 @@
+#include <errno.h>
+#include <poll.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "engine.h"
+#include "solve.h"
+
+/* Solving one position with many processes. The coordinator expands
+	the root a few plies deep and hands the positions at the bottom
+	(tasks) to worker processes connected to a Unix domain socket, each
+	together with a window of final disk differences it needs to be
+	solved within. Results come back as exact values or bounds and are
+	combined by minimax over the expanded tree until the root is exact.
+
+	Windows follow alpha-beta: a node only matters where it could beat
+	what its siblings have already shown, so a task's window is narrowed
+	by the results of the tasks before it, and whole subtrees are skipped
+	once they can no longer change their parent. As in "young brothers
+	wait", the other children of a node are only handed out once its
+	first child is resolved, since that usually gives the window that
+	cuts off the rest.
+
+	Protocol, one line per message:
+		worker:      ready
+		coordinator: task <id> <board> <alpha> <beta>
+		worker:      result <id> <diff> exact|upper|lower <nodes>
+		coordinator: done
+	A worker asks for its next task by sending its result. A worker
+	that disconnects with a task is simply replaced: the task goes back
+	to the queue for whoever asks next, and results that come back
+	late are still used, since bounds never become wrong. */
+
+struct snode {
+	int parent;
+	int first, n;			/* Children, consecutive in the array */
+	int move;				/* Move from the parent, -1 for a pass */
+	int lower, upper;		/* Bounds on the final disk difference for the side to move */
+	int busy;				/* A worker is searching this leaf */
+	char board[NUMTILES+2];	/* parseboard() format */
+};
+
+struct conn {
+	int fd;
+	int task;				/* Leaf being searched, or -1 */
+	int idle;				/* Waiting for a task */
+	size_t len;
+	char buf[256];
+};
+
+struct solver {
+	struct snode *nodes;
+	int numnodes, size;
+	struct conn conns[SOLVE_MAXCONNS];
+	int numconns;
+	unsigned long tasks, lost, searched;
+};
+
+static double now(void) {
+	struct timeval tv;
+	gettimeofday(&tv,NULL);
+	return tv.tv_sec+(tv.tv_usec/1000000.0);
+}
+
+/** Write a line to a socket. A peer that went away doesn't raise
+	SIGPIPE; reading from it reports the disconnection instead. */
+static void sendline(int fd, const char *fmt, ...) {
+	char buf[512];
+	va_list ap;
+	size_t len, n;
+	ssize_t w;
+
+	va_start(ap, fmt);
+	len = vsnprintf(buf, sizeof buf-1, fmt, ap);
+	va_end(ap);
+	if (len > sizeof buf-2)
+		len = sizeof buf-2;
+	buf[len++] = '\n';
+	for (n=0; n<len; n+=w)
+		if ((w = send(fd, buf+n, len-n, MSG_NOSIGNAL)) <= 0)
+			break;
+}
+
+static int addnode(struct solver *s, int parent, int move, int *board) {
+	struct snode *p, *n;
+
+	if (s->numnodes == s->size) {
+		s->size = s->size ? 2*s->size : 256;
+		if ((p = realloc(s->nodes, s->size * sizeof *s->nodes)) == NULL)
+			return -1;
+		s->nodes = p;
+	}
+	n = &s->nodes[s->numnodes];
+	n->parent = parent;
+	n->first = n->n = 0;
+	n->move = move;
+	n->lower = -NUMTILES;
+	n->upper = NUMTILES;
+	n->busy = 0;
+	boardtostr(board, n->board);
+	return s->numnodes++;
+}
+
+/** Give node i its children down to the given number of plies. Games
+	that end on the way are scored at once. Returns -1 if out of memory. */
+static int expand(struct solver *s, int i, int *board, int plies) {
+	int legalmoves[MAXMOVES], flipped[MAXMOVES], child[ARRSIZE];
+	int k, first = s->numnodes;
+
+	getmoves(board, legalmoves);
+	if (terminaltest(legalmoves, board)) {
+		s->nodes[i].lower = s->nodes[i].upper = TURN(board)*h_diskdiff(board);
+		return 0;
+	}
+	if (plies == 0)
+		return 0;
+
+	for (k=1; k<=legalmoves[0]; k++) {
+		memcpy(child, board, sizeof child);
+		results(child, legalmoves[k], flipped);
+		if (addnode(s, i, legalmoves[k], child) < 0)
+			return -1;
+	}
+	s->nodes[i].first = first;
+	s->nodes[i].n = legalmoves[0];
+	for (k=1; k<=legalmoves[0]; k++) {
+		memcpy(child, board, sizeof child);
+		results(child, legalmoves[k], flipped);
+		if (expand(s, first+k-1, child, plies-1) < 0)
+			return -1;
+	}
+	return 0;
+}
+
+/** Whether a node needs no more work for a window (alpha, beta) */
+static int resolved(struct snode *n, int alpha, int beta) {
+	return n->lower == n->upper || n->upper <= alpha || n->lower >= beta;
+}
+
+/** Find the next leaf below node i to search, given the window of
+	node i. Returns its index and sets its window, or returns -1 if
+	nothing below node i can be searched right now. */
+static int pick(struct solver *s, int i, int alpha, int beta, int *wa, int *wb) {
+	struct snode *n = &s->nodes[i];
+	int j, k, best, leaf;
+
+	if (resolved(n, alpha, beta))
+		return -1;
+	if (n->n == 0) {
+		if (n->busy)
+			return -1;
+		*wa = alpha;
+		*wb = beta;
+		return i;
+	}
+	for (k=0; k<n->n; k++) {
+		// What this node is already sure to get from the other children
+		for (best=alpha, j=0; j<n->n; j++)
+			if (j != k && -s->nodes[n->first+j].upper > best)
+				best = -s->nodes[n->first+j].upper;
+		if ((leaf = pick(s, n->first+k, -beta, -best, wa, wb)) >= 0)
+			return leaf;
+		if (k == 0 && !resolved(&s->nodes[n->first], -beta, -best))
+			return -1;	// Young brothers wait
+	}
+	return -1;
+}
+
+/** Recompute the bounds of an inner node from its children by minimax. */
+static void minimax(struct solver *s, int i) {
+	struct snode *n = &s->nodes[i], *c;
+	int k;
+
+	n->lower = n->upper = -NUMTILES;
+	for (k=0; k<n->n; k++) {
+		c = &s->nodes[n->first+k];
+		if (-c->upper > n->lower)
+			n->lower = -c->upper;
+		if (-c->lower > n->upper)
+			n->upper = -c->lower;
+	}
+}
+
+/** Update the ancestors of node i after its bounds changed. */
+static void propagate(struct solver *s, int i) {
+	for (i=s->nodes[i].parent; i>=0; i=s->nodes[i].parent)
+		minimax(s, i);
+}
+
+/** Give every idle worker a task, if there are any to give. */
+static void assign(struct solver *s) {
+	struct conn *c;
+	int i, leaf, alpha, beta;
+
+	for (i=0; i<s->numconns; i++) {
+		c = &s->conns[i];
+		if (!c->idle)
+			continue;
+		if ((leaf = pick(s, 0, -NUMTILES-1, NUMTILES+1, &alpha, &beta)) < 0)
+			return;
+		s->nodes[leaf].busy = 1;
+		c->task = leaf;
+		c->idle = 0;
+		s->tasks++;
+		sendline(c->fd, "task %d %s %d %d", leaf, s->nodes[leaf].board, alpha, beta);
+	}
+}
+
+/** Handle one message from a worker. */
+static void message(struct solver *s, struct conn *c, char *line) {
+	struct snode *n;
+	char *save, *word = strtok_r(line, " \t\r\n", &save), *arg[4];
+	int i, diff;
+
+	if (word == NULL)
+		return;
+	if (strcmp(word, "ready") == 0) {
+		c->idle = 1;
+		return;
+	}
+	if (strcmp(word, "result") != 0)
+		return;
+	for (i=0; i<4; i++)
+		if ((arg[i] = strtok_r(NULL, " \t\r\n", &save)) == NULL)
+			return;
+	if ((i = atoi(arg[0])) < 0 || i >= s->numnodes || s->nodes[i].n > 0)
+		return;
+
+	n = &s->nodes[i];
+	diff = atoi(arg[1]);
+	if (strcmp(arg[2], "exact") == 0)
+		n->lower = n->upper = diff;
+	else if (strcmp(arg[2], "upper") == 0 && diff < n->upper)
+		n->upper = diff;
+	else if (strcmp(arg[2], "lower") == 0 && diff > n->lower)
+		n->lower = diff;
+	if (c->task == i) {
+		n->busy = 0;
+		c->task = -1;
+	}
+	c->idle = 1;
+	s->searched += strtoul(arg[3], NULL, 10);
+	propagate(s, i);
+
+	printf("task %5d  %s  %s %+d  nodes %s  root [%+d,%+d]\n", i, n->board,
+			strcmp(arg[2], "exact") == 0 ? "=" : strcmp(arg[2], "upper") == 0 ? "<=" : ">=",
+			diff, arg[3], s->nodes[0].lower, s->nodes[0].upper);
+	fflush(stdout);
+}
+
+/** Read what a worker sent. Returns -1 once it has disconnected. */
+static int receive(struct solver *s, struct conn *c) {
+	char *p, *end;
+	ssize_t r;
+
+	if ((r = read(c->fd, c->buf+c->len, sizeof c->buf-1-c->len)) <= 0)
+		return -1;
+	c->len += r;
+	c->buf[c->len] = '\0';
+	for (p=c->buf; (end = strchr(p, '\n')) != NULL; p=end+1) {
+		*end = '\0';
+		message(s, c, p);
+	}
+	c->len -= p-c->buf;
+	memmove(c->buf, p, c->len);
+	if (c->len == sizeof c->buf-1)	// Overlong line
+		c->len = 0;
+	return 0;
+}
+
+/** Solve the position in a file (loadboard() format) by splitting it
+	at the given depth, with workers connecting to a Unix domain socket
+	at sockpath. nworkers local worker processes are started too; more
+	can join from anywhere that reaches the socket, and they may come
+	and go while the solve runs. Prints every result as it arrives and
+	then the value of the position and the best move. Returns 0, or -1
+	on error. */
+int solve_coordinate(const char *fname, const char *sockpath, int plies, int nworkers) {
+	static struct solver solver;
+	struct solver *s = &solver;
+	struct sockaddr_un addr;
+	struct pollfd fds[SOLVE_MAXCONNS+1];
+	struct conn *c;
+	int board[ARRSIZE];
+	int i, fd, client, best = -1, numleaves = 0;
+	double start = now();
+	char move[8];
+
+	if (loadboard((char *)fname, board) < 0)
+		return -1;
+	if (addnode(s, -1, 0, board) < 0 || expand(s, 0, board, plies) < 0) {
+		fprintf(stderr,"Error: Out of memory.\n");
+		return -1;
+	}
+	// Children come after their parent, so this sees them first
+	for (i=s->numnodes-1; i>=0; i--) {
+		if (s->nodes[i].n > 0)
+			minimax(s, i);
+		else if (s->nodes[i].lower != s->nodes[i].upper)
+			numleaves++;
+	}
+	if (s->nodes[0].lower == s->nodes[0].upper)
+		nworkers = 0;	// Over already
+	printf("Split %s at %d plies into %d positions to solve\n", s->nodes[0].board, plies, numleaves);
+	fflush(stdout);
+
+	memset(&addr, 0, sizeof addr);
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, sockpath, sizeof addr.sun_path-1);
+	unlink(sockpath);
+	if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0
+			|| bind(fd, (struct sockaddr *)&addr, sizeof addr) < 0
+			|| listen(fd, 64) < 0) {
+		fprintf(stderr,"Error: Could not listen on \"%s\": %s\n",sockpath,strerror(errno));
+		return -1;
+	}
+	for (i=0; i<nworkers; i++) {
+		if (fork() == 0) {
+			close(fd);
+			_exit(solve_worker(sockpath) < 0);
+		}
+	}
+
+	while (s->nodes[0].lower != s->nodes[0].upper) {
+		fds[0].fd = fd;
+		fds[0].events = POLLIN;
+		for (i=0; i<s->numconns; i++) {
+			fds[i+1].fd = s->conns[i].fd;
+			fds[i+1].events = POLLIN;
+		}
+		if (poll(fds, s->numconns+1, -1) < 0) {
+			if (errno == EINTR)
+				continue;
+			fprintf(stderr,"Error: poll() failed: %s\n",strerror(errno));
+			break;
+		}
+
+		for (i=s->numconns-1; i>=0; i--) {
+			c = &s->conns[i];
+			if (!fds[i+1].revents || receive(s, c) == 0)
+				continue;
+			if (c->task >= 0) {
+				fprintf(stderr,"Warning: A worker left during task %d, which goes back to the queue.\n",c->task);
+				s->nodes[c->task].busy = 0;
+				s->lost++;
+			}
+			close(c->fd);
+			*c = s->conns[--s->numconns];
+		}
+		if ((fds[0].revents & POLLIN) && (client = accept(fd, NULL, NULL)) >= 0) {
+			if (s->numconns == SOLVE_MAXCONNS)
+				close(client);
+			else {
+				c = &s->conns[s->numconns++];
+				memset(c, 0, sizeof *c);
+				c->fd = client;
+				c->task = -1;
+			}
+		}
+		assign(s);
+	}
+
+	for (i=0; i<s->numconns; i++) {
+		sendline(s->conns[i].fd, "done");
+		close(s->conns[i].fd);
+	}
+	close(fd);
+	unlink(sockpath);
+	while (wait(NULL) > 0);
+
+	for (i=0; i<s->nodes[0].n; i++)
+		if (-s->nodes[s->nodes[0].first+i].upper == s->nodes[0].lower)
+			best = s->nodes[s->nodes[0].first+i].move;
+	printf("\nResult %+d  move %s  tasks %lu  lost %lu  nodes %lu  time %.3f\n", s->nodes[0].lower,
+			s->nodes[0].n ? movetostr(best, move) : "none", s->tasks, s->lost, s->searched, now()-start);
+	free(s->nodes);
+	return 0;
+}
+
+/** Connect to a coordinator and solve the tasks it gives until it
+	says it's done. Returns 0, or -1 if the coordinator couldn't be
+	reached within SOLVE_RETRY seconds. */
+int solve_worker(const char *sockpath) {
+	struct sockaddr_un addr;
+	struct searchresult result;
+	struct engine *e;
+	struct ecache *ec;
+	char line[512], *save, *word[5];
+	int i, fd = -1, bound, diff, board[ARRSIZE];
+	FILE *fp;
+
+	memset(&addr, 0, sizeof addr);
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, sockpath, sizeof addr.sun_path-1);
+	for (i=0; i<SOLVE_RETRY; i++) {
+		if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) >= 0
+				&& connect(fd, (struct sockaddr *)&addr, sizeof addr) == 0)
+			break;
+		if (fd >= 0)
+			close(fd);
+		fd = -1;
+		sleep(1);
+	}
+	if (fd < 0) {
+		fprintf(stderr,"Error: Could not connect to \"%s\": %s\n",sockpath,strerror(errno));
+		return -1;
+	}
+	if ((e = engine_create()) == NULL || (ec = ec_create(EC_DEFAULTSIZE)) == NULL
+			|| (fp = fdopen(fd, "r")) == NULL) {
+		fprintf(stderr,"Error: Could not create the engine.\n");
+		return -1;
+	}
+	// Positions of one solve transpose into each other, so nothing is cleared between tasks
+	engine_setecache(e, ec);
+
+	sendline(fd, "ready");
+	while (fgets(line, sizeof line, fp)) {
+		for (i=0; i<5; i++)
+			if ((word[i] = strtok_r(i ? NULL : line, " \t\r\n", &save)) == NULL)
+				break;
+		if (i > 0 && strcmp(word[0], "done") == 0)
+			break;
+		if (i < 5 || strcmp(word[0], "task") != 0 || parseboard(word[2], board) < 0)
+			continue;
+
+		engine_setposition(e, board);
+		bound = engine_solve(e, atoi(word[3]), atoi(word[4]), &result);
+		diff = (result.score >= 0) ? result.score-END : result.score+END;
+		sendline(fd, "result %s %d %s %lu", word[1], diff,
+				bound == TT_EXACT ? "exact" : bound == TT_UPPER ? "upper" : "lower", result.nodes);
+	}
+
+	fclose(fp);
+	engine_destroy(e);
+	ec_destroy(ec);
+	return 0;
+}
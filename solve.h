@@ -0,0 +1,11 @@
+#ifndef SOLVE_H
+#define SOLVE_H
+
+#define SOLVE_PLIES 2		/* Default depth at which the root is split into tasks */
+#define SOLVE_RETRY 30		/* Seconds a worker keeps trying to reach the coordinator */
+#define SOLVE_MAXCONNS 256	/* Workers connected at once */
+
+int solve_coordinate(const char *fname, const char *sockpath, int plies, int nworkers);
+int solve_worker(const char *sockpath);
+
+#endif
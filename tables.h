@@ -0,0 +1,4645 @@
+#if BOARDSIZE == 6
+
+/* Generated by gentables.c - do not edit. */
+
+// Column, row and diagonals of each position
+static const uint8_t sq_x[57] = {
+	  0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   1,   2,   3,   4,   5,
+	  0,   0,   1,   2,   3,   4,   5,
+	  0,   0,   1,   2,   3,   4,   5,
+	  0,   0,   1,   2,   3,   4,   5,
+	  0,   0,   1,   2,   3,   4,   5,
+	  0,   0,   1,   2,   3,   4,   5,
+	  0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const uint8_t sq_y[57] = {
+	  0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,
+	  0,   1,   1,   1,   1,   1,   1,
+	  0,   2,   2,   2,   2,   2,   2,
+	  0,   3,   3,   3,   3,   3,   3,
+	  0,   4,   4,   4,   4,   4,   4,
+	  0,   5,   5,   5,   5,   5,   5,
+	  0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const uint8_t sq_diag1[57] = {
+	  0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   1,   2,   3,   4,   5,
+	  0,   1,   2,   3,   4,   5,   6,
+	  0,   2,   3,   4,   5,   6,   7,
+	  0,   3,   4,   5,   6,   7,   8,
+	  0,   4,   5,   6,   7,   8,   9,
+	  0,   5,   6,   7,   8,   9,  10,
+	  0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const uint8_t sq_diag2[57] = {
+	  0,   0,   0,   0,   0,   0,   0,
+	  0,   5,   4,   3,   2,   1,   0,
+	  0,   6,   5,   4,   3,   2,   1,
+	  0,   7,   6,   5,   4,   3,   2,
+	  0,   8,   7,   6,   5,   4,   3,
+	  0,   9,   8,   7,   6,   5,   4,
+	  0,  10,   9,   8,   7,   6,   5,
+	  0,   0,   0,   0,   0,   0,   0,   0
+};
+
+/* Bitmask of the directions in dirs[] in which a move at each
+	position could flip pieces */
+static const uint8_t flipdir[57] = {
+	  0,   0,   0,   0,   0,   0,   0,
+	  0, 208, 208, 248, 248, 104, 104,
+	  0, 208, 208, 248, 248, 104, 104,
+	  0, 214, 214, 255, 255, 107, 107,
+	  0, 214, 214, 255, 255, 107, 107,
+	  0,  22,  22,  31,  31,  11,  11,
+	  0,  22,  22,  31,  31,  11,  11,
+	  0,   0,   0,   0,   0,   0,   0,   0
+};
+
+// Fixed value of each square for h_disksquare()
+static const int16_t disksquare[57] = {
+	  0,   0,   0,   0,   0,   0,   0,
+	  0, 500,  -5,   6,   6,  -5, 500,
+	  0,  -5, -24,  -3,  -3, -24,  -5,
+	  0,   6,  -3,   5,   5,  -3,   6,
+	  0,   6,  -3,   5,   5,  -3,   6,
+	  0,  -5, -24,  -3,  -3, -24,  -5,
+	  0, 500,  -5,   6,   6,  -5, 500,
+	  0,   0,   0,   0,   0,   0,   0,   0
+};
+
+// Quadrant of each position, 4 off the board
+static const uint8_t quadrant[57] = {
+	  4,   4,   4,   4,   4,   4,   4,
+	  4,   0,   0,   0,   1,   1,   1,
+	  4,   0,   0,   0,   1,   1,   1,
+	  4,   0,   0,   0,   1,   1,   1,
+	  4,   2,   2,   2,   3,   3,   3,
+	  4,   2,   2,   2,   3,   3,   3,
+	  4,   2,   2,   2,   3,   3,   3,
+	  4,   4,   4,   4,   4,   4,   4,   4
+};
+
+// Positions ordered from best to worst, the order moves are tried in
+static const uint8_t positions[NUMTILES] = {
+	8, 13, 43, 48, 24, 25, 31, 32, 10, 11, 22, 27, 29, 34, 45, 46,
+	17, 18, 23, 26, 30, 33, 38, 39, 9, 12, 15, 20, 36, 41, 44, 47,
+	16, 19, 37, 40
+};
+
+/* Random keys used to hash positions (Zobrist hashing). zobrist[pos][0]
+	is xored in for a PLAYER1 piece at pos and zobrist[pos][1] for a
+	PLAYER2 piece. ZOBRIST_TURN is xored in when it's PLAYER2's turn. */
+#define ZOBRIST_TURN 0x6870d580c15d330aULL
+static const uint64_t zobrist[57][2] = {
+	{0,0}, {0,0}, {0,0}, {0,0},
+	{0,0}, {0,0}, {0,0}, {0,0},
+	{0xa2521e75c639b32cULL,0x6985bb37ba92dfc7ULL}, {0x4b2a4f322c4135dfULL,0xe8289e29546200a3ULL}, {0x4f6a45218ce57786ULL,0x9c586b229800ebf6ULL}, {0xbda6b697c0f02b83ULL,0x5fbbad3263feff7bULL},
+	{0x5f9ad02dec1f7124ULL,0xe22747ba6be18208ULL}, {0xf443841ce2d1944bULL,0x316998f2f179043eULL}, {0,0}, {0x208911382d22a7b7ULL,0xa8c3bbe30f27833fULL},
+	{0x20a4cfa78c26aa2eULL,0xe866d661520b1c64ULL}, {0x66aef6a67e4d5b67ULL,0x30bab5df1455b2feULL}, {0x071288615380ab3aULL,0xc390c139f923513cULL}, {0x4a298c3adfb8b60cULL,0x4f3e68675c28555eULL},
+	{0xcae2f940635e3e19ULL,0xab30d717e1160134ULL}, {0,0}, {0xe5f1259a1931924bULL,0xe86d555719d047c8ULL}, {0x470341cb969597eaULL,0x711bf0d421262f62ULL},
+	{0x5a449e5aed2bded9ULL,0xb39e4658e7a91765ULL}, {0x3ca6de6c8104d376ULL,0x435d325c7c4a6e54ULL}, {0x062f36941e7aeec0ULL,0x15a23201a3a35019ULL}, {0x7e4dd2f1e4fa3f84ULL,0x10f7f7c72b2755b7ULL},
+	{0,0}, {0x261bd0f167cab619ULL,0x1dc54e7885c5ac1aULL}, {0x0fed5298497c3676ULL,0x70c7d0b69513f5d4ULL}, {0xbc9dd37331324925ULL,0x6bbe0401600ce76dULL},
+	{0x18a4c637c82810b0ULL,0x6a57505b01687352ULL}, {0xd5813662e5ba0bfdULL,0x80ca5a274255edb3ULL}, {0x3b0c317cfe12480aULL,0x1935f7a9a0b61840ULL}, {0,0},
+	{0xa426df12c26964cdULL,0x355c487046f42bc8ULL}, {0x581649fec676f6f2ULL,0xdfb558313670ee88ULL}, {0xafc90f96f39f7ff2ULL,0x6a97981fe7b19a69ULL}, {0xcb2b3fd427e51932ULL,0xcadb88c8fb89b2afULL},
+	{0x3d997049bd685af2ULL,0xdfd4b8ededff5cf1ULL}, {0xa819201d9718430fULL,0xfe912a777775bdebULL}, {0,0}, {0x488135ea0c993f71ULL,0x6962c6136003139dULL},
+	{0x1612714358c1c465ULL,0xfb035f1f96e9eac4ULL}, {0x94fcf842b17e2bdeULL,0x083c810a597056c9ULL}, {0xc17752e6b4843e7dULL,0xb7d398b61ef1b531ULL}, {0x6bdaf738a875c1d3ULL,0x57789ac2d293e84cULL},
+	{0xf9bdb9673ba16f27ULL,0xee98ec8a20366908ULL}, {0,0}, {0,0}, {0,0},
+	{0,0}, {0,0}, {0,0}, {0,0},
+	{0,0}
+};
+
+// Positions that aren't on an edge, in order
+#define NUMINNER 16
+static const uint8_t inner[NUMINNER] = {
+	16, 17, 18, 19,
+	23, 24, 25, 26,
+	30, 31, 32, 33,
+	37, 38, 39, 40
+};
+
+// Positions along each edge: top, bottom, left, right
+static const uint8_t edges[4][6] = {
+	{8, 9, 10, 11, 12, 13},
+	{43, 44, 45, 46, 47, 48},
+	{8, 15, 22, 29, 36, 43},
+	{13, 20, 27, 34, 41, 48}
+};
+
+/* Stable pieces for each configuration of an edge, indexed as in
+	gentables.c; bit i is set if the i-th piece of the edge is stable. */
+static const uint8_t edgestable[729] = {
+	  0, 32, 32,  0, 48, 32,  0, 32, 48,  0, 32, 32,  0, 56, 32,  0,
+	 32, 48,  0, 32, 32,  0, 48, 32,  0, 32, 56,  0, 32, 32,  0, 48,
+	 32,  0, 32, 48,  0, 32, 32,  0, 60, 32,  0, 32, 48,  0, 32, 32,
+	  0, 48, 48,  0, 32, 56,  0, 32, 32,  0, 48, 32,  0, 32, 48,  0,
+	 32, 32,  0, 56, 32,  0, 48, 48,  0, 32, 32,  0, 48, 32,  0, 32,
+	 60,  0, 32, 32,  0, 48, 32,  0, 32, 48,  0, 32, 32,  0, 56, 32,
+	  0, 48, 48,  0, 32, 32,  0, 48, 32,  0, 32, 56,  0, 32, 32,  0,
+	 48, 32,  0, 32, 48,  0, 32, 32,  0, 62, 32,  0, 48, 48,  0, 32,
+	 32,  8, 56, 56,  0, 56, 56,  0, 32, 32,  0, 48, 32,  0, 32, 48,
+	  0, 36, 36,  4, 60, 60, 12, 60, 60,  0, 32, 32, 12, 60, 60,  0,
+	 60, 60,  0, 32, 32,  0, 48, 32,  0, 32, 48,  0, 32, 32,  0, 56,
+	 32,  0, 32, 48,  0, 32, 32,  0, 48, 48,  0, 32, 56,  0, 32, 32,
+	  0, 48, 32,  0, 32, 48,  0, 32, 32,  0, 60, 60, 12, 60, 60,  0,
+	 36, 36, 12, 60, 60,  4, 60, 60,  0, 32, 32,  0, 48, 32,  0, 32,
+	 48,  0, 32, 32,  0, 56, 56,  8, 56, 56,  0, 32, 32,  0, 48, 48,
+	  0, 32, 62,  1, 33, 33,  1, 49, 33,  1, 33, 49,  1, 33, 33,  1,
+	 57, 33,  1, 33, 49,  1, 33, 33,  1, 49, 33,  1, 33, 57,  1, 33,
+	 33,  1, 49, 33,  1, 33, 49,  1, 33, 33,  1, 61, 33,  1, 49, 49,
+	  1, 33, 33,  9, 57, 57,  1, 57, 57,  1, 33, 33,  1, 49, 33,  1,
+	 33, 49,  1, 33, 33,  1, 57, 57,  9, 57, 57,  1, 33, 33,  1, 49,
+	 49,  1, 33, 61,  3, 35, 35,  3, 51, 35,  3, 35, 51,  3, 35, 35,
+	  3, 59, 35,  3, 51, 51,  3, 35, 35,  3, 51, 51,  3, 35, 59,  7,
+	 39, 39,  7, 55, 39,  7, 39, 55, 15, 47, 47, 31, 63, 63, 15, 63,
+	 63,  7, 39, 39, 15, 63, 63,  7, 63, 63,  3, 35, 35,  3, 51, 35,
+	  3, 35, 51,  3, 39, 39,  7, 63, 63, 15, 63, 63,  3, 35, 35, 15,
+	 63, 63,  3, 63, 63,  1, 33, 33,  1, 49, 33,  1, 33, 49,  1, 33,
+	 33,  1, 57, 33,  1, 49, 49,  1, 33, 33,  1, 49, 49,  1, 33, 57,
+	  1, 33, 33,  3, 51, 35,  1, 35, 51,  1, 35, 35,  3, 63, 63, 15,
+	 63, 63,  3, 39, 39, 15, 63, 63,  7, 63, 63,  1, 33, 33,  1, 49,
+	 33,  1, 33, 49,  1, 39, 39,  7, 63, 63, 15, 63, 63,  1, 33, 33,
+	 15, 63, 63,  1, 63, 63,  1, 33, 33,  1, 49, 33,  1, 33, 49,  1,
+	 33, 33,  1, 57, 33,  1, 33, 49,  1, 33, 33,  1, 49, 33,  1, 33,
+	 57,  1, 33, 33,  1, 49, 33,  1, 33, 49,  1, 33, 33,  1, 61, 33,
+	  1, 49, 49,  1, 33, 33,  9, 57, 57,  1, 57, 57,  1, 33, 33,  1,
+	 49, 33,  1, 33, 49,  1, 33, 33,  1, 57, 57,  9, 57, 57,  1, 33,
+	 33,  1, 49, 49,  1, 33, 61,  1, 33, 33,  1, 49, 33,  1, 33, 49,
+	  1, 33, 33,  1, 57, 33,  1, 49, 49,  1, 33, 33,  1, 49, 49,  1,
+	 33, 57,  1, 33, 33,  1, 49, 33,  1, 33, 49,  1, 33, 33,  1, 63,
+	 63, 15, 63, 63,  1, 39, 39, 15, 63, 63,  7, 63, 63,  1, 33, 33,
+	  1, 51, 35,  3, 35, 51,  3, 39, 39,  7, 63, 63, 15, 63, 63,  1,
+	 35, 35, 15, 63, 63,  3, 63, 63,  3, 35, 35,  3, 51, 35,  3, 35,
+	 51,  3, 35, 35,  3, 59, 35,  3, 51, 51,  3, 35, 35,  3, 51, 51,
+	  3, 35, 59,  3, 35, 35,  3, 51, 35,  3, 35, 51,  3, 35, 35,  3,
+	 63, 63, 15, 63, 63,  3, 39, 39, 15, 63, 63,  7, 63, 63,  7, 39,
+	 39,  7, 55, 39,  7, 39, 55,  7, 39, 39,  7, 63, 63, 15, 63, 63,
+	 15, 47, 47, 15, 63, 63, 31, 63, 63
+};
+
+#endif
+
+#if BOARDSIZE == 8
+
+/* Generated by gentables.c - do not edit. */
+
+// Column, row and diagonals of each position
+static const uint8_t sq_x[91] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const uint8_t sq_y[91] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   1,   1,   1,   1,   1,   1,   1,   1,
+	  0,   2,   2,   2,   2,   2,   2,   2,   2,
+	  0,   3,   3,   3,   3,   3,   3,   3,   3,
+	  0,   4,   4,   4,   4,   4,   4,   4,   4,
+	  0,   5,   5,   5,   5,   5,   5,   5,   5,
+	  0,   6,   6,   6,   6,   6,   6,   6,   6,
+	  0,   7,   7,   7,   7,   7,   7,   7,   7,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const uint8_t sq_diag1[91] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,
+	  0,   1,   2,   3,   4,   5,   6,   7,   8,
+	  0,   2,   3,   4,   5,   6,   7,   8,   9,
+	  0,   3,   4,   5,   6,   7,   8,   9,  10,
+	  0,   4,   5,   6,   7,   8,   9,  10,  11,
+	  0,   5,   6,   7,   8,   9,  10,  11,  12,
+	  0,   6,   7,   8,   9,  10,  11,  12,  13,
+	  0,   7,   8,   9,  10,  11,  12,  13,  14,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const uint8_t sq_diag2[91] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   7,   6,   5,   4,   3,   2,   1,   0,
+	  0,   8,   7,   6,   5,   4,   3,   2,   1,
+	  0,   9,   8,   7,   6,   5,   4,   3,   2,
+	  0,  10,   9,   8,   7,   6,   5,   4,   3,
+	  0,  11,  10,   9,   8,   7,   6,   5,   4,
+	  0,  12,  11,  10,   9,   8,   7,   6,   5,
+	  0,  13,  12,  11,  10,   9,   8,   7,   6,
+	  0,  14,  13,  12,  11,  10,   9,   8,   7,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+/* Bitmask of the directions in dirs[] in which a move at each
+	position could flip pieces */
+static const uint8_t flipdir[91] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0, 208, 208, 248, 248, 248, 248, 104, 104,
+	  0, 208, 208, 248, 248, 248, 248, 104, 104,
+	  0, 214, 214, 255, 255, 255, 255, 107, 107,
+	  0, 214, 214, 255, 255, 255, 255, 107, 107,
+	  0, 214, 214, 255, 255, 255, 255, 107, 107,
+	  0, 214, 214, 255, 255, 255, 255, 107, 107,
+	  0,  22,  22,  31,  31,  31,  31,  11,  11,
+	  0,  22,  22,  31,  31,  31,  31,  11,  11,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+// Fixed value of each square for h_disksquare()
+static const int16_t disksquare[91] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0, 500,  -5,   8,   6,   6,   8,  -5, 500,
+	  0,  -5, -24,  -4,  -3,  -3,  -4, -24,  -5,
+	  0,   8,  -4,   7,   2,   2,   7,  -4,   8,
+	  0,   6,  -3,   2,   5,   5,   2,  -3,   6,
+	  0,   6,  -3,   2,   5,   5,   2,  -3,   6,
+	  0,   8,  -4,   7,   2,   2,   7,  -4,   8,
+	  0,  -5, -24,  -4,  -3,  -3,  -4, -24,  -5,
+	  0, 500,  -5,   8,   6,   6,   8,  -5, 500,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+// Quadrant of each position, 4 off the board
+static const uint8_t quadrant[91] = {
+	  4,   4,   4,   4,   4,   4,   4,   4,   4,
+	  4,   0,   0,   0,   0,   1,   1,   1,   1,
+	  4,   0,   0,   0,   0,   1,   1,   1,   1,
+	  4,   0,   0,   0,   0,   1,   1,   1,   1,
+	  4,   0,   0,   0,   0,   1,   1,   1,   1,
+	  4,   2,   2,   2,   2,   3,   3,   3,   3,
+	  4,   2,   2,   2,   2,   3,   3,   3,   3,
+	  4,   2,   2,   2,   2,   3,   3,   3,   3,
+	  4,   2,   2,   2,   2,   3,   3,   3,   3,
+	  4,   4,   4,   4,   4,   4,   4,   4,   4,   4
+};
+
+// Positions ordered from best to worst, the order moves are tried in
+static const uint8_t positions[NUMTILES] = {
+	10, 17, 73, 80, 40, 41, 49, 50, 12, 15, 28, 35, 55, 62, 75, 78,
+	30, 33, 57, 60, 13, 14, 37, 44, 46, 53, 76, 77, 31, 32, 39, 42,
+	48, 51, 58, 59, 22, 23, 38, 43, 47, 52, 67, 68, 21, 24, 29, 34,
+	56, 61, 66, 69, 11, 16, 19, 26, 64, 71, 74, 79, 20, 25, 65, 70
+};
+
+/* Random keys used to hash positions (Zobrist hashing). zobrist[pos][0]
+	is xored in for a PLAYER1 piece at pos and zobrist[pos][1] for a
+	PLAYER2 piece. ZOBRIST_TURN is xored in when it's PLAYER2's turn. */
+#define ZOBRIST_TURN 0x6870d580c15d330aULL
+static const uint64_t zobrist[91][2] = {
+	{0,0}, {0,0}, {0,0}, {0,0},
+	{0,0}, {0,0}, {0,0}, {0,0},
+	{0,0}, {0,0}, {0xa2521e75c639b32cULL,0x6985bb37ba92dfc7ULL}, {0x4b2a4f322c4135dfULL,0xe8289e29546200a3ULL},
+	{0x4f6a45218ce57786ULL,0x9c586b229800ebf6ULL}, {0xbda6b697c0f02b83ULL,0x5fbbad3263feff7bULL}, {0x5f9ad02dec1f7124ULL,0xe22747ba6be18208ULL}, {0xf443841ce2d1944bULL,0x316998f2f179043eULL},
+	{0x208911382d22a7b7ULL,0xa8c3bbe30f27833fULL}, {0x20a4cfa78c26aa2eULL,0xe866d661520b1c64ULL}, {0,0}, {0x66aef6a67e4d5b67ULL,0x30bab5df1455b2feULL},
+	{0x071288615380ab3aULL,0xc390c139f923513cULL}, {0x4a298c3adfb8b60cULL,0x4f3e68675c28555eULL}, {0xcae2f940635e3e19ULL,0xab30d717e1160134ULL}, {0xe5f1259a1931924bULL,0xe86d555719d047c8ULL},
+	{0x470341cb969597eaULL,0x711bf0d421262f62ULL}, {0x5a449e5aed2bded9ULL,0xb39e4658e7a91765ULL}, {0x3ca6de6c8104d376ULL,0x435d325c7c4a6e54ULL}, {0,0},
+	{0x062f36941e7aeec0ULL,0x15a23201a3a35019ULL}, {0x7e4dd2f1e4fa3f84ULL,0x10f7f7c72b2755b7ULL}, {0x261bd0f167cab619ULL,0x1dc54e7885c5ac1aULL}, {0x0fed5298497c3676ULL,0x70c7d0b69513f5d4ULL},
+	{0xbc9dd37331324925ULL,0x6bbe0401600ce76dULL}, {0x18a4c637c82810b0ULL,0x6a57505b01687352ULL}, {0xd5813662e5ba0bfdULL,0x80ca5a274255edb3ULL}, {0x3b0c317cfe12480aULL,0x1935f7a9a0b61840ULL},
+	{0,0}, {0xa426df12c26964cdULL,0x355c487046f42bc8ULL}, {0x581649fec676f6f2ULL,0xdfb558313670ee88ULL}, {0xafc90f96f39f7ff2ULL,0x6a97981fe7b19a69ULL},
+	{0xcb2b3fd427e51932ULL,0xcadb88c8fb89b2afULL}, {0x3d997049bd685af2ULL,0xdfd4b8ededff5cf1ULL}, {0xa819201d9718430fULL,0xfe912a777775bdebULL}, {0x488135ea0c993f71ULL,0x6962c6136003139dULL},
+	{0x1612714358c1c465ULL,0xfb035f1f96e9eac4ULL}, {0,0}, {0x94fcf842b17e2bdeULL,0x083c810a597056c9ULL}, {0xc17752e6b4843e7dULL,0xb7d398b61ef1b531ULL},
+	{0x6bdaf738a875c1d3ULL,0x57789ac2d293e84cULL}, {0xf9bdb9673ba16f27ULL,0xee98ec8a20366908ULL}, {0x1c00d176185c797dULL,0xb551a29d0c3986ecULL}, {0x5bcd6967a8864030ULL,0x929f4d122dc6aadcULL},
+	{0x58983037fd906b0cULL,0x9258c14a520802cdULL}, {0x88634af60c5969feULL,0x2d9f19627918804aULL}, {0,0}, {0xbf7454a573f765e5ULL,0xab769be256b2a5abULL},
+	{0xd7e610ed0d8f1d90ULL,0x36b9d125fa30db71ULL}, {0x510e3fbae1855695ULL,0x0e701abc9ea9aedfULL}, {0xdc0c94adffb361e0ULL,0x89f44b7a9b2fd604ULL}, {0x4952a6c45f83c4c2ULL,0x55150a73915c8cd1ULL},
+	{0x8bef0a4bc92785e3ULL,0xd77ebfe6b734000cULL}, {0x64092c6bd0e7cf65ULL,0xb5a4c5e6f087ea58ULL}, {0xd32ab72396c3dec2ULL,0x53ef7dafc281bbf7ULL}, {0,0},
+	{0x0a97a44f4d91a60fULL,0x307031c4f21e9796ULL}, {0xda7e5a8c1f626376ULL,0x0d434997c74e8266ULL}, {0xff16c49faa9b434dULL,0x18d59a07c7bd0eb1ULL}, {0x38dfa3a18ba0ddbaULL,0x0f7c707884a49048ULL},
+	{0x5860f2d6d34342c9ULL,0x45f762f131177ac0ULL}, {0x46acadeb0529c0e5ULL,0x620b315d02e55983ULL}, {0xd6248832aae73105ULL,0xfb41695ba1fbbe84ULL}, {0xff238e14b2594c7cULL,0x46043e9ddca0ac5dULL},
+	{0,0}, {0xa6a7d070f01820beULL,0xe892e9fdee12579bULL}, {0xde229bdb008fa67cULL,0x606b2aea23cae3d5ULL}, {0x9fb5281fc2887fe1ULL,0xedf9ded332ab3b60ULL},
+	{0x4441b8e613f2ad77ULL,0xb275b091820bd860ULL}, {0x63fcbfdf3dab4c45ULL,0x0e796bee299f4138ULL}, {0xa6158407c341f5a2ULL,0x72aaade1b9fdad28ULL}, {0xce28c227635090c0ULL,0xe21d953f7c50ede3ULL},
+	{0xf802fe382a3f0060ULL,0xbbd5e94caff00d0fULL}, {0,0}, {0,0}, {0,0},
+	{0,0}, {0,0}, {0,0}, {0,0},
+	{0,0}, {0,0}, {0,0}
+};
+
+// Positions that aren't on an edge, in order
+#define NUMINNER 36
+static const uint8_t inner[NUMINNER] = {
+	20, 21, 22, 23, 24, 25,
+	29, 30, 31, 32, 33, 34,
+	38, 39, 40, 41, 42, 43,
+	47, 48, 49, 50, 51, 52,
+	56, 57, 58, 59, 60, 61,
+	65, 66, 67, 68, 69, 70
+};
+
+// Positions along each edge: top, bottom, left, right
+static const uint8_t edges[4][8] = {
+	{10, 11, 12, 13, 14, 15, 16, 17},
+	{73, 74, 75, 76, 77, 78, 79, 80},
+	{10, 19, 28, 37, 46, 55, 64, 73},
+	{17, 26, 35, 44, 53, 62, 71, 80}
+};
+
+/* Stable pieces for each configuration of an edge, indexed as in
+	gentables.c; bit i is set if the i-th piece of the edge is stable. */
+static const uint8_t edgestable[6561] = {
+	  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,224,128,  0,
+	128,192,  0,128,128,  0,192,128,  0,128,224,  0,128,128,  0,192,
+	128,  0,128,192,  0,128,128,  0,240,128,  0,128,192,  0,128,128,
+	  0,192,128,  0,128,224,  0,128,128,  0,192,128,  0,128,192,  0,
+	128,128,  0,224,128,  0,128,192,  0,128,128,  0,192,128,  0,128,
+	240,  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,224,128,
+	  0,128,192,  0,128,128,  0,192,128,  0,128,224,  0,128,128,  0,
+	192,128,  0,128,192,  0,128,128,  0,248,128,  0,128,192,  0,128,
+	128,  0,192,128,  0,128,224,  0,128,128,  0,192,128,  0,128,192,
+	  0,128,128,  0,224,128,  0,192,192,  0,128,128,  0,192,128,  0,
+	128,240,  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,224,
+	128,  0,128,192,  0,128,128,  0,192,128,  0,128,224,  0,128,128,
+	  0,192,128,  0,128,192,  0,128,128,  0,240,128,  0,128,192,  0,
+	128,128,  0,192,192,  0,128,224,  0,128,128,  0,192,128,  0,128,
+	192,  0,128,128,  0,224,128,  0,128,192,  0,128,128,  0,192,128,
+	  0,128,248,  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,
+	224,128,  0,128,192,  0,128,128,  0,192,128,  0,128,224,  0,128,
+	128,  0,192,128,  0,128,192,  0,128,128,  0,240,128,  0,128,192,
+	  0,128,128,  0,192,192,  0,128,224,  0,128,128,  0,192,128,  0,
+	128,192,  0,128,128,  0,224,128,  0,128,192,  0,128,128,  0,192,
+	128,  0,128,240,  0,128,128,  0,192,128,  0,128,192,  0,128,128,
+	  0,224,128,  0,128,192,  0,128,128,  0,192,128,  0,128,224,  0,
+	128,128,  0,192,128,  0,128,192,  0,128,128,  0,252,128,  0,128,
+	192,  0,128,128,  0,192,192,  0,128,224,  0,128,128,  0,192,128,
+	  0,128,192,  0,128,128,  0,224,224, 32,224,224,  0,128,128,  0,
+	192,192,  0,128,240,  0,128,128,  0,192,128,  0,128,192,  0,128,
+	128,  0,224,128,  0,128,192,  0,128,128,  0,192,128,  0,128,224,
+	  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,240,240, 48,
+	240,240,  0,144,144, 48,240,240, 16,240,240,  0,128,128,  0,192,
+	128,  0,128,192,  0,128,128,  0,224,224, 32,224,224,  0,128,128,
+	  0,192,192,  0,128,248,  0,128,128,  0,192,128,  0,128,192,  0,
+	128,128,  0,224,128,  0,128,192,  0,128,128,  0,192,128,  0,128,
+	224,  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,240,128,
+	  0,128,192,  0,128,128,  0,192,128,  0,128,224,  0,128,128,  0,
+	192,128,  0,128,192,  0,128,128,  0,224,128,  0,192,192,  0,128,
+	128,  0,192,128,  0,128,240,  0,128,128,  0,192,128,  0,128,192,
+	  0,128,128,  0,224,128,  0,128,192,  0,128,128,  0,192,128,  0,
+	128,224,  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,248,
+	128,  0,192,192,  0,128,128, 32,224,224,  0,224,224,  0,128,128,
+	  0,192,128,  0,128,192,  0,144,144, 16,240,240, 48,240,240,  0,
+	128,128, 48,240,240,  0,240,240,  0,128,128,  0,192,128,  0,128,
+	192,  0,128,128,  0,224,128,  0,128,192,  0,128,128,  0,192,128,
+	  0,128,224,  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,
+	240,128,  0,192,192,  0,128,128, 32,224,224,  0,224,224,  0,128,
+	128,  0,192,128,  0,128,192,  0,128,128,  0,224,128,  0,192,192,
+	  0,128,128,  0,192,128,  0,128,252,  0,128,128,  0,192,128,  0,
+	128,192,  0,128,128,  0,224,128,  0,128,192,  0,128,128,  0,192,
+	128,  0,128,224,  0,128,128,  0,192,128,  0,128,192,  0,128,128,
+	  0,240,128,  0,128,192,  0,128,128,  0,192,128,  0,128,224,  0,
+	128,128,  0,192,128,  0,128,192,  0,128,128,  0,224,128,  0,192,
+	192,  0,128,128,  0,192,128,  0,128,240,  0,128,128,  0,192,128,
+	  0,128,192,  0,128,128,  0,224,128,  0,192,192,  0,128,128,  0,
+	192,128,  0,128,224,  0,128,128,  0,192,128,  0,128,192,  0,128,
+	128,  0,248,128,  0,192,192,  0,128,128, 32,224,224,  0,224,224,
+	  0,128,128,  0,192,128,  0,128,192,  0,144,144, 16,240,240, 48,
+	240,240,  0,128,128, 48,240,240,  0,240,240,  0,128,128,  0,192,
+	128,  0,128,192,  0,128,128,  0,224,128,  0,128,192,  0,128,128,
+	  0,192,128,  0,128,224,  0,128,128,  0,192,128,  0,128,192,  0,
+	128,128,  0,240,128,  0,192,192,  0,128,128, 32,224,224,  0,224,
+	224,  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,224,128,
+	  0,192,192,  0,128,128,  0,192,128,  0,128,248,  0,128,128,  0,
+	192,128,  0,128,192,  0,128,128,  0,224,128,  0,128,192,  0,128,
+	128,  0,192,128,  0,128,224,  0,128,128,  0,192,128,  0,128,192,
+	  0,128,128,  0,240,128,  0,192,192,  0,128,128, 32,224,224,  0,
+	224,224,  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,224,
+	128,  0,192,192,  0,128,128,  0,192,128,  0,128,240,  0,128,128,
+	  0,192,128,  0,128,192,  0,128,128,  0,224,128,  0,192,192,  0,
+	128,128,  0,192,128,  0,128,224,  0,128,128,  0,192,128,  0,128,
+	192,  0,128,128,  0,254,128,  0,192,192,  0,128,128, 32,224,224,
+	  0,224,224,  0,128,128,  0,192,128,  0,128,192,  0,144,144, 16,
+	240,240, 48,240,240,  0,128,128, 48,240,240,  0,240,240,  0,128,
+	128,  0,192,128,  0,128,192,  0,128,128,  0,224,128,  0,192,192,
+	  0,128,128,  0,192,128,  0,128,224,  0,128,128,  8,200,136,  0,
+	136,200,  0,136,136,  8,248,248, 56,248,248,  8,152,152, 56,248,
+	248, 24,248,248,  0,128,128,  0,192,128,  0,128,192,  0,152,152,
+	 24,248,248, 56,248,248,  0,128,128, 56,248,248,  0,248,248,  0,
+	128,128,  0,192,128,  0,128,192,  0,128,128,  0,224,128,  0,128,
+	192,  0,128,128,  0,192,128,  0,128,224,  0,128,128,  0,192,128,
+	  0,128,192,  0,128,128,  0,240,128,  0,192,192,  0,128,128, 32,
+	224,224,  0,224,224,  0,128,128,  0,192,128,  0,128,192,  0,128,
+	128,  0,224,128,  0,192,192,  0,128,128,  0,192,128,  0,128,240,
+	  0,128,128,  0,192,128,  0,128,192,  0,132,132,  4,228,132,  0,
+	196,196,  0,128,128,  4,196,196,  0,132,228,  0,128,128,  4,196,
+	132,  0,132,196,  0,132,132,  4,252,252, 60,252,252,  4,156,156,
+	 60,252,252, 28,252,252,  0,132,132,  4,204,140, 12,140,204, 12,
+	156,156, 28,252,252, 60,252,252,  4,140,140, 60,252,252, 12,252,
+	252,  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,224,128,
+	  0,192,192,  0,128,128,  0,192,128,  0,128,224,  0,128,128, 12,
+	204,140,  0,140,204,  0,140,140, 12,252,252, 60,252,252, 12,156,
+	156, 60,252,252, 28,252,252,  0,128,128,  0,192,128,  0,128,192,
+	  0,156,156, 28,252,252, 60,252,252,  0,128,128, 60,252,252,  0,
+	252,252,  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,224,
+	128,  0,128,192,  0,128,128,  0,192,128,  0,128,224,  0,128,128,
+	  0,192,128,  0,128,192,  0,128,128,  0,240,128,  0,128,192,  0,
+	128,128,  0,192,192,  0,128,224,  0,128,128,  0,192,128,  0,128,
+	192,  0,128,128,  0,224,128,  0,128,192,  0,128,128,  0,192,128,
+	  0,128,240,  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,
+	224,128,  0,128,192,  0,128,128,  0,192,128,  0,128,224,  0,128,
+	128,  0,192,128,  0,128,192,  0,128,128,  0,248,128,  0,128,192,
+	  0,128,128,  0,192,192,  0,128,224,  0,128,128,  0,192,128,  0,
+	128,192,  0,128,128,  0,224,224, 32,224,224,  0,128,128,  0,192,
+	192,  0,128,240,  0,128,128,  0,192,128,  0,128,192,  0,128,128,
+	  0,224,128,  0,128,192,  0,128,128,  0,192,192,  0,128,224,  0,
+	128,128,  0,192,128,  0,128,192,  0,128,128,  0,240,240, 48,240,
+	240,  0,144,144, 48,240,240, 16,240,240,  0,128,128,  0,192,128,
+	  0,128,192,  0,128,128,  0,224,224, 32,224,224,  0,128,128,  0,
+	192,192,  0,128,248,  0,128,128,  0,192,128,  0,128,192,  0,128,
+	128,  0,224,128,  0,128,192,  0,128,128,  0,192,128,  0,128,224,
+	  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,240,128,  0,
+	128,192,  0,128,128,  0,192,192,  0,128,224,  0,128,128,  0,192,
+	128,  0,128,192,  0,128,128,  0,224,224, 32,224,224,  0,128,128,
+	  0,192,192,  0,128,240,  0,128,128,  0,192,128,  0,128,192,  0,
+	128,128,  0,224,128,  0,128,192,  0,128,128,  0,192,192,  0,128,
+	224,  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,252,252,
+	 60,252,252,  0,156,156, 60,252,252, 28,252,252,  0,128,128,  0,
+	204,140, 12,140,204, 12,156,156, 28,252,252, 60,252,252,  0,140,
+	140, 60,252,252, 12,252,252,  0,128,128,  0,192,128,  0,128,192,
+	  0,128,128,  0,228,132,  4,196,196,  0,132,132,  0,196,196,  4,
+	132,228,  0,132,132, 12,204,140,  4,140,204,  4,140,140, 12,252,
+	252, 60,252,252, 12,156,156, 60,252,252, 28,252,252,  0,128,128,
+	  0,196,132,  4,132,196,  4,156,156, 28,252,252, 60,252,252,  0,
+	132,132, 60,252,252,  4,252,252,  0,128,128,  0,192,128,  0,128,
+	192,  0,128,128,  0,224,128,  0,128,192,  0,128,128,  0,192,128,
+	  0,128,224,  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,
+	240,128,  0,128,192,  0,128,128,  0,192,192,  0,128,224,  0,128,
+	128,  0,192,128,  0,128,192,  0,128,128,  0,224,224, 32,224,224,
+	  0,128,128,  0,192,192,  0,128,240,  0,128,128,  0,192,128,  0,
+	128,192,  0,128,128,  0,224,128,  0,128,192,  0,128,128,  0,192,
+	192,  0,128,224,  0,128,128,  0,192,128,  0,128,192,  0,128,128,
+	  0,248,248, 56,248,248,  0,152,152, 56,248,248, 24,248,248,  0,
+	128,128,  0,200,136,  8,136,200,  8,152,152, 24,248,248, 56,248,
+	248,  0,136,136, 56,248,248,  8,248,248,  0,128,128,  0,192,128,
+	  0,128,192,  0,128,128,  0,224,128,  0,128,192,  0,128,128,  0,
+	192,192,  0,128,224,  0,128,128,  0,192,128,  0,128,192,  0,128,
+	128,  0,240,240, 48,240,240,  0,144,144, 48,240,240, 16,240,240,
+	  0,128,128,  0,192,128,  0,128,192,  0,128,128,  0,224,224, 32,
+	224,224,  0,128,128,  0,192,192,  0,128,254,  1,129,129,  1,193,
+	129,  1,129,193,  1,129,129,  1,225,129,  1,129,193,  1,129,129,
+	  1,193,129,  1,129,225,  1,129,129,  1,193,129,  1,129,193,  1,
+	129,129,  1,241,129,  1,129,193,  1,129,129,  1,193,129,  1,129,
+	225,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,
+	  1,129,193,  1,129,129,  1,193,129,  1,129,241,  1,129,129,  1,
+	193,129,  1,129,193,  1,129,129,  1,225,129,  1,129,193,  1,129,
+	129,  1,193,129,  1,129,225,  1,129,129,  1,193,129,  1,129,193,
+	  1,129,129,  1,249,129,  1,129,193,  1,129,129,  1,193,193,  1,
+	129,225,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,
+	225, 33,225,225,  1,129,129,  1,193,193,  1,129,241,  1,129,129,
+	  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,129,193,  1,
+	129,129,  1,193,129,  1,129,225,  1,129,129,  1,193,129,  1,129,
+	193,  1,129,129,  1,241,129,  1,193,193,  1,129,129, 33,225,225,
+	  1,225,225,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,
+	225,129,  1,193,193,  1,129,129,  1,193,129,  1,129,249,  1,129,
+	129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,129,193,
+	  1,129,129,  1,193,129,  1,129,225,  1,129,129,  1,193,129,  1,
+	129,193,  1,129,129,  1,241,129,  1,193,193,  1,129,129, 33,225,
+	225,  1,225,225,  1,129,129,  1,193,129,  1,129,193,  1,129,129,
+	  1,225,129,  1,193,193,  1,129,129,  1,193,129,  1,129,241,  1,
+	129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,193,
+	193,  1,129,129,  1,193,129,  1,129,225,  1,129,129,  1,193,129,
+	  1,129,193,  1,129,129,  1,253,129,  1,193,193,  1,129,129, 33,
+	225,225,  1,225,225,  1,129,129,  1,193,129,  1,129,193,  1,145,
+	145, 17,241,241, 49,241,241,  1,129,129, 49,241,241,  1,241,241,
+	  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,
+	193,193,  1,129,129,  1,193,129,  1,129,225,  1,129,129,  9,201,
+	137,  1,137,201,  1,137,137,  9,249,249, 57,249,249,  9,153,153,
+	 57,249,249, 25,249,249,  1,129,129,  1,193,129,  1,129,193,  1,
+	153,153, 25,249,249, 57,249,249,  1,129,129, 57,249,249,  1,249,
+	249,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,
+	  1,129,193,  1,129,129,  1,193,129,  1,129,225,  1,129,129,  1,
+	193,129,  1,129,193,  1,129,129,  1,241,129,  1,129,193,  1,129,
+	129,  1,193,193,  1,129,225,  1,129,129,  1,193,129,  1,129,193,
+	  1,129,129,  1,225,225, 33,225,225,  1,129,129,  1,193,193,  1,
+	129,241,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,
+	129,  1,129,193,  1,129,129,  1,193,193,  1,129,225,  1,129,129,
+	  1,193,129,  1,129,193,  1,129,129,  1,249,249, 57,249,249,  1,
+	153,153, 57,249,249, 25,249,249,  1,129,129,  1,201,137,  9,137,
+	201,  9,153,153, 25,249,249, 57,249,249,  1,137,137, 57,249,249,
+	  9,249,249,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,
+	225,129,  1,129,193,  1,129,129,  1,193,193,  1,129,225,  1,129,
+	129,  1,193,129,  1,129,193,  1,129,129,  1,241,241, 49,241,241,
+	  1,145,145, 49,241,241, 17,241,241,  1,129,129,  1,193,129,  1,
+	129,193,  1,129,129,  1,225,225, 33,225,225,  1,129,129,  1,193,
+	193,  1,129,253,  3,131,131,  3,195,131,  3,131,195,  3,131,131,
+	  3,227,131,  3,131,195,  3,131,131,  3,195,131,  3,131,227,  3,
+	131,131,  3,195,131,  3,131,195,  3,131,131,  3,243,131,  3,131,
+	195,  3,131,131,  3,195,195,  3,131,227,  3,131,131,  3,195,131,
+	  3,131,195,  3,131,131,  3,227,131,  3,195,195,  3,131,131,  3,
+	195,131,  3,131,243,  3,131,131,  3,195,131,  3,131,195,  3,131,
+	131,  3,227,131,  3,195,195,  3,131,131,  3,195,131,  3,131,227,
+	  3,131,131,  3,195,131,  3,131,195,  3,131,131,  3,251,131,  3,
+	195,195,  3,131,131, 35,227,227,  3,227,227,  3,131,131,  3,195,
+	131,  3,131,195,  3,147,147, 19,243,243, 51,243,243,  3,131,131,
+	 51,243,243,  3,243,243,  3,131,131,  3,195,131,  3,131,195,  3,
+	131,131,  3,227,131,  3,131,195,  3,131,131,  3,195,195,  3,131,
+	227,  3,131,131,  3,195,131,  3,131,195,  3,131,131,  3,243,243,
+	 51,243,243,  3,147,147, 51,243,243, 19,243,243,  3,131,131,  3,
+	195,131,  3,131,195,  3,131,131,  3,227,227, 35,227,227,  3,131,
+	131,  3,195,195,  3,131,251,  7,135,135,  7,199,135,  7,135,199,
+	  7,135,135,  7,231,135,  7,135,199,  7,135,135,  7,199,135,  7,
+	135,231,  7,135,135,  7,199,135,  7,135,199,  7,135,135,  7,247,
+	135,  7,199,199,  7,135,135, 39,231,231,  7,231,231,  7,135,135,
+	  7,199,135,  7,135,199,  7,135,135,  7,231,231, 39,231,231,  7,
+	135,135,  7,199,199,  7,135,247, 15,143,143, 15,207,143, 15,143,
+	207, 15,143,143, 15,239,143, 15,207,207, 15,143,143, 15,207,207,
+	 15,143,239, 31,159,159, 31,223,159, 31,159,223, 63,191,191,127,
+	255,255, 63,255,255, 31,159,159, 63,255,255, 31,255,255, 15,143,
+	143, 15,207,143, 15,143,207, 15,159,159, 31,255,255, 63,255,255,
+	 15,143,143, 63,255,255, 15,255,255,  7,135,135,  7,199,135,  7,
+	135,199,  7,135,135,  7,231,135,  7,199,199,  7,135,135,  7,199,
+	199,  7,135,231,  7,135,135, 15,207,143,  7,143,207,  7,143,143,
+	 15,255,255, 63,255,255, 15,159,159, 63,255,255, 31,255,255,  7,
+	135,135,  7,199,135,  7,135,199,  7,159,159, 31,255,255, 63,255,
+	255,  7,135,135, 63,255,255,  7,255,255,  3,131,131,  3,195,131,
+	  3,131,195,  3,131,131,  3,227,131,  3,131,195,  3,131,131,  3,
+	195,131,  3,131,227,  3,131,131,  3,195,131,  3,131,195,  3,131,
+	131,  3,243,131,  3,195,195,  3,131,131, 35,227,227,  3,227,227,
+	  3,131,131,  3,195,131,  3,131,195,  3,131,131,  3,227,227, 35,
+	227,227,  3,131,131,  3,195,195,  3,131,243,  3,131,131,  3,195,
+	131,  3,131,195,  3,135,135,  7,231,135,  3,199,199,  3,131,131,
+	  7,199,199,  3,135,231,  3,131,131,  7,199,135,  3,135,199,  3,
+	135,135,  7,255,255, 63,255,255,  7,159,159, 63,255,255, 31,255,
+	255,  3,135,135,  7,207,143, 15,143,207, 15,159,159, 31,255,255,
+	 63,255,255,  7,143,143, 63,255,255, 15,255,255,  3,131,131,  3,
+	195,131,  3,131,195,  3,131,131,  3,227,131,  3,195,195,  3,131,
+	131,  3,195,195,  3,131,227,  3,131,131, 15,207,143,  3,143,207,
+	  3,143,143, 15,255,255, 63,255,255, 15,159,159, 63,255,255, 31,
+	255,255,  3,131,131,  3,195,131,  3,131,195,  3,159,159, 31,255,
+	255, 63,255,255,  3,131,131, 63,255,255,  3,255,255,  1,129,129,
+	  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,129,193,  1,
+	129,129,  1,193,129,  1,129,225,  1,129,129,  1,193,129,  1,129,
+	193,  1,129,129,  1,241,129,  1,129,193,  1,129,129,  1,193,193,
+	  1,129,225,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,
+	225,129,  1,193,193,  1,129,129,  1,193,129,  1,129,241,  1,129,
+	129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,193,193,
+	  1,129,129,  1,193,129,  1,129,225,  1,129,129,  1,193,129,  1,
+	129,193,  1,129,129,  1,249,129,  1,193,193,  1,129,129, 33,225,
+	225,  1,225,225,  1,129,129,  1,193,129,  1,129,193,  1,145,145,
+	 17,241,241, 49,241,241,  1,129,129, 49,241,241,  1,241,241,  1,
+	129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,129,
+	193,  1,129,129,  1,193,193,  1,129,225,  1,129,129,  1,193,129,
+	  1,129,193,  1,129,129,  1,241,241, 49,241,241,  1,145,145, 49,
+	241,241, 17,241,241,  1,129,129,  1,193,129,  1,129,193,  1,129,
+	129,  1,225,225, 33,225,225,  1,129,129,  1,193,193,  1,129,249,
+	  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,
+	129,193,  1,129,129,  1,193,129,  1,129,225,  1,129,129,  3,195,
+	131,  1,131,195,  1,131,131,  3,243,131,  1,195,195,  1,129,129,
+	 35,227,227,  1,227,227,  1,129,129,  1,193,129,  1,129,193,  1,
+	131,131,  3,227,227, 35,227,227,  1,129,129,  3,195,195,  1,131,
+	243,  1,129,129,  1,193,129,  1,129,193,  1,131,131,  3,227,131,
+	  1,195,195,  1,129,129,  3,195,195,  1,131,227,  1,129,129,  3,
+	195,131,  1,131,195,  1,131,131,  3,255,255, 63,255,255,  3,159,
+	159, 63,255,255, 31,255,255,  1,131,131,  3,207,143, 15,143,207,
+	 15,159,159, 31,255,255, 63,255,255,  3,143,143, 63,255,255, 15,
+	255,255,  1,129,129,  3,195,131,  1,131,195,  1,131,131,  3,231,
+	135,  7,199,199,  3,135,135,  3,199,199,  7,135,231,  3,135,135,
+	 15,207,143,  7,143,207,  7,143,143, 15,255,255, 63,255,255, 15,
+	159,159, 63,255,255, 31,255,255,  1,131,131,  3,199,135,  7,135,
+	199,  7,159,159, 31,255,255, 63,255,255,  3,135,135, 63,255,255,
+	  7,255,255,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,
+	225,129,  1,129,193,  1,129,129,  1,193,129,  1,129,225,  1,129,
+	129,  1,193,129,  1,129,193,  1,129,129,  1,241,129,  1,193,193,
+	  1,129,129, 33,225,225,  1,225,225,  1,129,129,  1,193,129,  1,
+	129,193,  1,129,129,  1,225,225, 33,225,225,  1,129,129,  1,193,
+	193,  1,129,241,  1,129,129,  1,193,129,  1,129,193,  1,135,135,
+	  7,231,135,  1,199,199,  1,129,129,  7,199,199,  1,135,231,  1,
+	129,129,  7,199,135,  1,135,199,  1,135,135,  7,255,255, 63,255,
+	255,  7,159,159, 63,255,255, 31,255,255,  1,135,135,  7,207,143,
+	 15,143,207, 15,159,159, 31,255,255, 63,255,255,  7,143,143, 63,
+	255,255, 15,255,255,  1,129,129,  1,193,129,  1,129,193,  1,129,
+	129,  1,225,129,  1,193,193,  1,129,129,  1,193,193,  1,129,225,
+	  1,129,129, 15,207,143,  1,143,207,  1,143,143, 15,255,255, 63,
+	255,255, 15,159,159, 63,255,255, 31,255,255,  1,129,129,  1,193,
+	129,  1,129,193,  1,159,159, 31,255,255, 63,255,255,  1,129,129,
+	 63,255,255,  1,255,255,  1,129,129,  1,193,129,  1,129,193,  1,
+	129,129,  1,225,129,  1,129,193,  1,129,129,  1,193,129,  1,129,
+	225,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,241,129,
+	  1,129,193,  1,129,129,  1,193,129,  1,129,225,  1,129,129,  1,
+	193,129,  1,129,193,  1,129,129,  1,225,129,  1,129,193,  1,129,
+	129,  1,193,129,  1,129,241,  1,129,129,  1,193,129,  1,129,193,
+	  1,129,129,  1,225,129,  1,129,193,  1,129,129,  1,193,129,  1,
+	129,225,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,249,
+	129,  1,129,193,  1,129,129,  1,193,193,  1,129,225,  1,129,129,
+	  1,193,129,  1,129,193,  1,129,129,  1,225,225, 33,225,225,  1,
+	129,129,  1,193,193,  1,129,241,  1,129,129,  1,193,129,  1,129,
+	193,  1,129,129,  1,225,129,  1,129,193,  1,129,129,  1,193,129,
+	  1,129,225,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,
+	241,129,  1,193,193,  1,129,129, 33,225,225,  1,225,225,  1,129,
+	129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,193,193,
+	  1,129,129,  1,193,129,  1,129,249,  1,129,129,  1,193,129,  1,
+	129,193,  1,129,129,  1,225,129,  1,129,193,  1,129,129,  1,193,
+	129,  1,129,225,  1,129,129,  1,193,129,  1,129,193,  1,129,129,
+	  1,241,129,  1,193,193,  1,129,129, 33,225,225,  1,225,225,  1,
+	129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,193,
+	193,  1,129,129,  1,193,129,  1,129,241,  1,129,129,  1,193,129,
+	  1,129,193,  1,129,129,  1,225,129,  1,193,193,  1,129,129,  1,
+	193,129,  1,129,225,  1,129,129,  1,193,129,  1,129,193,  1,129,
+	129,  1,253,129,  1,193,193,  1,129,129, 33,225,225,  1,225,225,
+	  1,129,129,  1,193,129,  1,129,193,  1,145,145, 17,241,241, 49,
+	241,241,  1,129,129, 49,241,241,  1,241,241,  1,129,129,  1,193,
+	129,  1,129,193,  1,129,129,  1,225,129,  1,193,193,  1,129,129,
+	  1,193,129,  1,129,225,  1,129,129,  9,201,137,  1,137,201,  1,
+	137,137,  9,249,249, 57,249,249,  9,153,153, 57,249,249, 25,249,
+	249,  1,129,129,  1,193,129,  1,129,193,  1,153,153, 25,249,249,
+	 57,249,249,  1,129,129, 57,249,249,  1,249,249,  1,129,129,  1,
+	193,129,  1,129,193,  1,129,129,  1,225,129,  1,129,193,  1,129,
+	129,  1,193,129,  1,129,225,  1,129,129,  1,193,129,  1,129,193,
+	  1,129,129,  1,241,129,  1,129,193,  1,129,129,  1,193,193,  1,
+	129,225,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,
+	225, 33,225,225,  1,129,129,  1,193,193,  1,129,241,  1,129,129,
+	  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,129,193,  1,
+	129,129,  1,193,193,  1,129,225,  1,129,129,  1,193,129,  1,129,
+	193,  1,129,129,  1,249,249, 57,249,249,  1,153,153, 57,249,249,
+	 25,249,249,  1,129,129,  1,201,137,  9,137,201,  9,153,153, 25,
+	249,249, 57,249,249,  1,137,137, 57,249,249,  9,249,249,  1,129,
+	129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,129,193,
+	  1,129,129,  1,193,193,  1,129,225,  1,129,129,  1,193,129,  1,
+	129,193,  1,129,129,  1,241,241, 49,241,241,  1,145,145, 49,241,
+	241, 17,241,241,  1,129,129,  1,193,129,  1,129,193,  1,129,129,
+	  1,225,225, 33,225,225,  1,129,129,  1,193,193,  1,129,253,  1,
+	129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,129,
+	193,  1,129,129,  1,193,129,  1,129,225,  1,129,129,  1,193,129,
+	  1,129,193,  1,129,129,  1,241,129,  1,129,193,  1,129,129,  1,
+	193,193,  1,129,225,  1,129,129,  1,193,129,  1,129,193,  1,129,
+	129,  1,225,129,  1,193,193,  1,129,129,  1,193,129,  1,129,241,
+	  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,  1,
+	193,193,  1,129,129,  1,193,129,  1,129,225,  1,129,129,  1,193,
+	129,  1,129,193,  1,129,129,  1,249,129,  1,193,193,  1,129,129,
+	 33,225,225,  1,225,225,  1,129,129,  1,193,129,  1,129,193,  1,
+	145,145, 17,241,241, 49,241,241,  1,129,129, 49,241,241,  1,241,
+	241,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,129,
+	  1,129,193,  1,129,129,  1,193,193,  1,129,225,  1,129,129,  1,
+	193,129,  1,129,193,  1,129,129,  1,241,241, 49,241,241,  1,145,
+	145, 49,241,241, 17,241,241,  1,129,129,  1,193,129,  1,129,193,
+	  1,129,129,  1,225,225, 33,225,225,  1,129,129,  1,193,193,  1,
+	129,249,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,225,
+	129,  1,129,193,  1,129,129,  1,193,129,  1,129,225,  1,129,129,
+	  1,193,129,  1,129,193,  1,129,129,  1,241,129,  1,193,193,  1,
+	129,129, 33,225,225,  1,225,225,  1,129,129,  1,193,129,  1,129,
+	193,  1,129,129,  1,225,225, 33,225,225,  1,129,129,  1,193,193,
+	  1,129,241,  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,
+	225,129,  1,193,193,  1,129,129,  1,193,193,  1,129,225,  1,129,
+	129,  1,193,129,  1,129,193,  1,129,129,  1,255,255, 63,255,255,
+	  1,159,159, 63,255,255, 31,255,255,  1,129,129,  1,207,143, 15,
+	143,207, 15,159,159, 31,255,255, 63,255,255,  1,143,143, 63,255,
+	255, 15,255,255,  1,129,129,  1,193,129,  1,129,193,  1,129,129,
+	  1,231,135,  7,199,199,  1,135,135,  1,199,199,  7,135,231,  1,
+	135,135, 15,207,143,  7,143,207,  7,143,143, 15,255,255, 63,255,
+	255, 15,159,159, 63,255,255, 31,255,255,  1,129,129,  1,199,135,
+	  7,135,199,  7,159,159, 31,255,255, 63,255,255,  1,135,135, 63,
+	255,255,  7,255,255,  1,129,129,  1,193,129,  1,129,193,  1,129,
+	129,  1,225,129,  1,129,193,  1,129,129,  1,193,129,  1,129,225,
+	  1,129,129,  1,193,129,  1,129,193,  1,129,129,  1,243,131,  3,
+	195,195,  1,131,131, 35,227,227,  3,227,227,  1,129,129,  1,195,
+	131,  3,131,195,  1,129,129,  1,227,227, 35,227,227,  1,131,131,
+	  1,195,195,  3,131,243,  1,129,129,  1,195,131,  3,131,195,  3,
+	135,135,  7,231,135,  3,199,199,  1,131,131,  7,199,199,  3,135,
+	231,  1,131,131,  7,199,135,  3,135,199,  3,135,135,  7,255,255,
+	 63,255,255,  7,159,159, 63,255,255, 31,255,255,  3,135,135,  7,
+	207,143, 15,143,207, 15,159,159, 31,255,255, 63,255,255,  7,143,
+	143, 63,255,255, 15,255,255,  1,129,129,  1,193,129,  1,129,193,
+	  1,129,129,  1,227,131,  3,195,195,  1,131,131,  1,195,195,  3,
+	131,227,  1,131,131, 15,207,143,  3,143,207,  3,143,143, 15,255,
+	255, 63,255,255, 15,159,159, 63,255,255, 31,255,255,  1,129,129,
+	  1,195,131,  3,131,195,  3,159,159, 31,255,255, 63,255,255,  1,
+	131,131, 63,255,255,  3,255,255,  3,131,131,  3,195,131,  3,131,
+	195,  3,131,131,  3,227,131,  3,131,195,  3,131,131,  3,195,131,
+	  3,131,227,  3,131,131,  3,195,131,  3,131,195,  3,131,131,  3,
+	243,131,  3,131,195,  3,131,131,  3,195,195,  3,131,227,  3,131,
+	131,  3,195,131,  3,131,195,  3,131,131,  3,227,131,  3,195,195,
+	  3,131,131,  3,195,131,  3,131,243,  3,131,131,  3,195,131,  3,
+	131,195,  3,131,131,  3,227,131,  3,195,195,  3,131,131,  3,195,
+	131,  3,131,227,  3,131,131,  3,195,131,  3,131,195,  3,131,131,
+	  3,251,131,  3,195,195,  3,131,131, 35,227,227,  3,227,227,  3,
+	131,131,  3,195,131,  3,131,195,  3,147,147, 19,243,243, 51,243,
+	243,  3,131,131, 51,243,243,  3,243,243,  3,131,131,  3,195,131,
+	  3,131,195,  3,131,131,  3,227,131,  3,131,195,  3,131,131,  3,
+	195,195,  3,131,227,  3,131,131,  3,195,131,  3,131,195,  3,131,
+	131,  3,243,243, 51,243,243,  3,147,147, 51,243,243, 19,243,243,
+	  3,131,131,  3,195,131,  3,131,195,  3,131,131,  3,227,227, 35,
+	227,227,  3,131,131,  3,195,195,  3,131,251,  3,131,131,  3,195,
+	131,  3,131,195,  3,131,131,  3,227,131,  3,131,195,  3,131,131,
+	  3,195,131,  3,131,227,  3,131,131,  3,195,131,  3,131,195,  3,
+	131,131,  3,243,131,  3,195,195,  3,131,131, 35,227,227,  3,227,
+	227,  3,131,131,  3,195,131,  3,131,195,  3,131,131,  3,227,227,
+	 35,227,227,  3,131,131,  3,195,195,  3,131,243,  3,131,131,  3,
+	195,131,  3,131,195,  3,131,131,  3,227,131,  3,195,195,  3,131,
+	131,  3,195,195,  3,131,227,  3,131,131,  3,195,131,  3,131,195,
+	  3,131,131,  3,255,255, 63,255,255,  3,159,159, 63,255,255, 31,
+	255,255,  3,131,131,  3,207,143, 15,143,207, 15,159,159, 31,255,
+	255, 63,255,255,  3,143,143, 63,255,255, 15,255,255,  3,131,131,
+	  3,195,131,  3,131,195,  3,131,131,  3,231,135,  7,199,199,  3,
+	135,135,  3,199,199,  7,135,231,  3,135,135, 15,207,143,  7,143,
+	207,  7,143,143, 15,255,255, 63,255,255, 15,159,159, 63,255,255,
+	 31,255,255,  3,131,131,  3,199,135,  7,135,199,  7,159,159, 31,
+	255,255, 63,255,255,  3,135,135, 63,255,255,  7,255,255,  7,135,
+	135,  7,199,135,  7,135,199,  7,135,135,  7,231,135,  7,135,199,
+	  7,135,135,  7,199,135,  7,135,231,  7,135,135,  7,199,135,  7,
+	135,199,  7,135,135,  7,247,135,  7,199,199,  7,135,135, 39,231,
+	231,  7,231,231,  7,135,135,  7,199,135,  7,135,199,  7,135,135,
+	  7,231,231, 39,231,231,  7,135,135,  7,199,199,  7,135,247,  7,
+	135,135,  7,199,135,  7,135,199,  7,135,135,  7,231,135,  7,199,
+	199,  7,135,135,  7,199,199,  7,135,231,  7,135,135,  7,199,135,
+	  7,135,199,  7,135,135,  7,255,255, 63,255,255,  7,159,159, 63,
+	255,255, 31,255,255,  7,135,135,  7,207,143, 15,143,207, 15,159,
+	159, 31,255,255, 63,255,255,  7,143,143, 63,255,255, 15,255,255,
+	 15,143,143, 15,207,143, 15,143,207, 15,143,143, 15,239,143, 15,
+	207,207, 15,143,143, 15,207,207, 15,143,239, 15,143,143, 15,207,
+	143, 15,143,207, 15,143,143, 15,255,255, 63,255,255, 15,159,159,
+	 63,255,255, 31,255,255, 31,159,159, 31,223,159, 31,159,223, 31,
+	159,159, 31,255,255, 63,255,255, 63,191,191, 63,255,255,127,255,
+	255
+};
+
+#endif
+
+#if BOARDSIZE == 10
+
+/* Generated by gentables.c - do not edit. */
+
+// Column, row and diagonals of each position
+static const uint8_t sq_x[133] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const uint8_t sq_y[133] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  0,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  0,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,
+	  0,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,
+	  0,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,
+	  0,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+	  0,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+	  0,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+	  0,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const uint8_t sq_diag1[133] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+	  0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,
+	  0,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,
+	  0,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,
+	  0,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,
+	  0,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,
+	  0,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+	  0,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+	  0,   8,   9,  10,  11,  12,  13,  14,  15,  16,  17,
+	  0,   9,  10,  11,  12,  13,  14,  15,  16,  17,  18,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const uint8_t sq_diag2[133] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   9,   8,   7,   6,   5,   4,   3,   2,   1,   0,
+	  0,  10,   9,   8,   7,   6,   5,   4,   3,   2,   1,
+	  0,  11,  10,   9,   8,   7,   6,   5,   4,   3,   2,
+	  0,  12,  11,  10,   9,   8,   7,   6,   5,   4,   3,
+	  0,  13,  12,  11,  10,   9,   8,   7,   6,   5,   4,
+	  0,  14,  13,  12,  11,  10,   9,   8,   7,   6,   5,
+	  0,  15,  14,  13,  12,  11,  10,   9,   8,   7,   6,
+	  0,  16,  15,  14,  13,  12,  11,  10,   9,   8,   7,
+	  0,  17,  16,  15,  14,  13,  12,  11,  10,   9,   8,
+	  0,  18,  17,  16,  15,  14,  13,  12,  11,  10,   9,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+/* Bitmask of the directions in dirs[] in which a move at each
+	position could flip pieces */
+static const uint8_t flipdir[133] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0, 208, 208, 248, 248, 248, 248, 248, 248, 104, 104,
+	  0, 208, 208, 248, 248, 248, 248, 248, 248, 104, 104,
+	  0, 214, 214, 255, 255, 255, 255, 255, 255, 107, 107,
+	  0, 214, 214, 255, 255, 255, 255, 255, 255, 107, 107,
+	  0, 214, 214, 255, 255, 255, 255, 255, 255, 107, 107,
+	  0, 214, 214, 255, 255, 255, 255, 255, 255, 107, 107,
+	  0, 214, 214, 255, 255, 255, 255, 255, 255, 107, 107,
+	  0, 214, 214, 255, 255, 255, 255, 255, 255, 107, 107,
+	  0,  22,  22,  31,  31,  31,  31,  31,  31,  11,  11,
+	  0,  22,  22,  31,  31,  31,  31,  31,  31,  11,  11,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+// Fixed value of each square for h_disksquare()
+static const int16_t disksquare[133] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0, 500,  -5,   8,   8,   6,   6,   8,   8,  -5, 500,
+	  0,  -5, -24,  -4,  -4,  -3,  -3,  -4,  -4, -24,  -5,
+	  0,   8,  -4,   7,   7,   2,   2,   7,   7,  -4,   8,
+	  0,   8,  -4,   7,   7,   2,   2,   7,   7,  -4,   8,
+	  0,   6,  -3,   2,   2,   5,   5,   2,   2,  -3,   6,
+	  0,   6,  -3,   2,   2,   5,   5,   2,   2,  -3,   6,
+	  0,   8,  -4,   7,   7,   2,   2,   7,   7,  -4,   8,
+	  0,   8,  -4,   7,   7,   2,   2,   7,   7,  -4,   8,
+	  0,  -5, -24,  -4,  -4,  -3,  -3,  -4,  -4, -24,  -5,
+	  0, 500,  -5,   8,   8,   6,   6,   8,   8,  -5, 500,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+// Quadrant of each position, 4 off the board
+static const uint8_t quadrant[133] = {
+	  4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,
+	  4,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,
+	  4,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,
+	  4,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,
+	  4,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,
+	  4,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,
+	  4,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,
+	  4,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,
+	  4,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,
+	  4,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,
+	  4,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,
+	  4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4
+};
+
+// Positions ordered from best to worst, the order moves are tried in
+static const uint8_t positions[NUMTILES] = {
+	12, 21, 111, 120, 60, 61, 71, 72, 14, 15, 18, 19, 34, 43, 45, 54,
+	78, 87, 89, 98, 113, 114, 117, 118, 36, 37, 40, 41, 47, 48, 51, 52,
+	80, 81, 84, 85, 91, 92, 95, 96, 16, 17, 56, 65, 67, 76, 115, 116,
+	38, 39, 49, 50, 58, 59, 62, 63, 69, 70, 73, 74, 82, 83, 93, 94,
+	27, 28, 57, 64, 68, 75, 104, 105, 25, 26, 29, 30, 35, 42, 46, 53,
+	79, 86, 90, 97, 102, 103, 106, 107, 13, 20, 23, 32, 100, 109, 112, 119,
+	24, 31, 101, 108
+};
+
+/* Random keys used to hash positions (Zobrist hashing). zobrist[pos][0]
+	is xored in for a PLAYER1 piece at pos and zobrist[pos][1] for a
+	PLAYER2 piece. ZOBRIST_TURN is xored in when it's PLAYER2's turn. */
+#define ZOBRIST_TURN 0x6870d580c15d330aULL
+static const uint64_t zobrist[133][2] = {
+	{0,0}, {0,0}, {0,0}, {0,0},
+	{0,0}, {0,0}, {0,0}, {0,0},
+	{0,0}, {0,0}, {0,0}, {0,0},
+	{0xa2521e75c639b32cULL,0x6985bb37ba92dfc7ULL}, {0x4b2a4f322c4135dfULL,0xe8289e29546200a3ULL}, {0x4f6a45218ce57786ULL,0x9c586b229800ebf6ULL}, {0xbda6b697c0f02b83ULL,0x5fbbad3263feff7bULL},
+	{0x5f9ad02dec1f7124ULL,0xe22747ba6be18208ULL}, {0xf443841ce2d1944bULL,0x316998f2f179043eULL}, {0x208911382d22a7b7ULL,0xa8c3bbe30f27833fULL}, {0x20a4cfa78c26aa2eULL,0xe866d661520b1c64ULL},
+	{0x66aef6a67e4d5b67ULL,0x30bab5df1455b2feULL}, {0x071288615380ab3aULL,0xc390c139f923513cULL}, {0,0}, {0x4a298c3adfb8b60cULL,0x4f3e68675c28555eULL},
+	{0xcae2f940635e3e19ULL,0xab30d717e1160134ULL}, {0xe5f1259a1931924bULL,0xe86d555719d047c8ULL}, {0x470341cb969597eaULL,0x711bf0d421262f62ULL}, {0x5a449e5aed2bded9ULL,0xb39e4658e7a91765ULL},
+	{0x3ca6de6c8104d376ULL,0x435d325c7c4a6e54ULL}, {0x062f36941e7aeec0ULL,0x15a23201a3a35019ULL}, {0x7e4dd2f1e4fa3f84ULL,0x10f7f7c72b2755b7ULL}, {0x261bd0f167cab619ULL,0x1dc54e7885c5ac1aULL},
+	{0x0fed5298497c3676ULL,0x70c7d0b69513f5d4ULL}, {0,0}, {0xbc9dd37331324925ULL,0x6bbe0401600ce76dULL}, {0x18a4c637c82810b0ULL,0x6a57505b01687352ULL},
+	{0xd5813662e5ba0bfdULL,0x80ca5a274255edb3ULL}, {0x3b0c317cfe12480aULL,0x1935f7a9a0b61840ULL}, {0xa426df12c26964cdULL,0x355c487046f42bc8ULL}, {0x581649fec676f6f2ULL,0xdfb558313670ee88ULL},
+	{0xafc90f96f39f7ff2ULL,0x6a97981fe7b19a69ULL}, {0xcb2b3fd427e51932ULL,0xcadb88c8fb89b2afULL}, {0x3d997049bd685af2ULL,0xdfd4b8ededff5cf1ULL}, {0xa819201d9718430fULL,0xfe912a777775bdebULL},
+	{0,0}, {0x488135ea0c993f71ULL,0x6962c6136003139dULL}, {0x1612714358c1c465ULL,0xfb035f1f96e9eac4ULL}, {0x94fcf842b17e2bdeULL,0x083c810a597056c9ULL},
+	{0xc17752e6b4843e7dULL,0xb7d398b61ef1b531ULL}, {0x6bdaf738a875c1d3ULL,0x57789ac2d293e84cULL}, {0xf9bdb9673ba16f27ULL,0xee98ec8a20366908ULL}, {0x1c00d176185c797dULL,0xb551a29d0c3986ecULL},
+	{0x5bcd6967a8864030ULL,0x929f4d122dc6aadcULL}, {0x58983037fd906b0cULL,0x9258c14a520802cdULL}, {0x88634af60c5969feULL,0x2d9f19627918804aULL}, {0,0},
+	{0xbf7454a573f765e5ULL,0xab769be256b2a5abULL}, {0xd7e610ed0d8f1d90ULL,0x36b9d125fa30db71ULL}, {0x510e3fbae1855695ULL,0x0e701abc9ea9aedfULL}, {0xdc0c94adffb361e0ULL,0x89f44b7a9b2fd604ULL},
+	{0x4952a6c45f83c4c2ULL,0x55150a73915c8cd1ULL}, {0x8bef0a4bc92785e3ULL,0xd77ebfe6b734000cULL}, {0x64092c6bd0e7cf65ULL,0xb5a4c5e6f087ea58ULL}, {0xd32ab72396c3dec2ULL,0x53ef7dafc281bbf7ULL},
+	{0x0a97a44f4d91a60fULL,0x307031c4f21e9796ULL}, {0xda7e5a8c1f626376ULL,0x0d434997c74e8266ULL}, {0,0}, {0xff16c49faa9b434dULL,0x18d59a07c7bd0eb1ULL},
+	{0x38dfa3a18ba0ddbaULL,0x0f7c707884a49048ULL}, {0x5860f2d6d34342c9ULL,0x45f762f131177ac0ULL}, {0x46acadeb0529c0e5ULL,0x620b315d02e55983ULL}, {0xd6248832aae73105ULL,0xfb41695ba1fbbe84ULL},
+	{0xff238e14b2594c7cULL,0x46043e9ddca0ac5dULL}, {0xa6a7d070f01820beULL,0xe892e9fdee12579bULL}, {0xde229bdb008fa67cULL,0x606b2aea23cae3d5ULL}, {0x9fb5281fc2887fe1ULL,0xedf9ded332ab3b60ULL},
+	{0x4441b8e613f2ad77ULL,0xb275b091820bd860ULL}, {0,0}, {0x63fcbfdf3dab4c45ULL,0x0e796bee299f4138ULL}, {0xa6158407c341f5a2ULL,0x72aaade1b9fdad28ULL},
+	{0xce28c227635090c0ULL,0xe21d953f7c50ede3ULL}, {0xf802fe382a3f0060ULL,0xbbd5e94caff00d0fULL}, {0xae50a3485929965eULL,0x9818a608d0359c93ULL}, {0x734bfd0edd0c78d3ULL,0x73d1eddcb29f6374ULL},
+	{0xb1b1b798bcfa61fcULL,0x39e5e6e299b803ffULL}, {0x2d9b4012d8f980b3ULL,0x22b268581eb739ceULL}, {0xde7a5ec3d81a9d8cULL,0x054e7640979f0c3fULL}, {0xdaa5cd6ac601077fULL,0x11b80d801b4f7972ULL},
+	{0,0}, {0xbf113fd2470af070ULL,0x4378c8193217020dULL}, {0xffe9858a6143bf6eULL,0x56d0467661f71d70ULL}, {0x044d699b74ebb6efULL,0x146453df6dc6fa66ULL},
+	{0xb93befc2be3658e2ULL,0x1b5a0be15f705dc3ULL}, {0x5c6dabd4158eb3b4ULL,0x1cddeede39a58de1ULL}, {0xbcdf6ff4a173bb2bULL,0x5a6c71ef8df33a0aULL}, {0xa6f9386dbbfff71fULL,0x7ec0222de69a04deULL},
+	{0xed1e555e10aad3c4ULL,0x4cdf5f2d0573680eULL}, {0xc0d4c91075071a2eULL,0x2c616403ae15ad53ULL}, {0xf6d0b704bd34e445ULL,0x7a00e6736d593314ULL}, {0,0},
+	{0xe355c721962f1346ULL,0x239145ac8200bb3aULL}, {0x473208c54b030642ULL,0x3f2a4910c74ca260ULL}, {0x02d0c826d3cc7d3dULL,0xf98e7522670863deULL}, {0xaddc9d41c1c9e48bULL,0xcf0b8ec23285f53bULL},
+	{0x99a874b30506776fULL,0xdf5b9a96eea1bf07ULL}, {0x8c7e08733587c0a6ULL,0x3a7a1fbee7830fe6ULL}, {0xa325f5af9932bc68ULL,0x292155172f6a9380ULL}, {0xf09918564b8bea96ULL,0x1f9796c4309202abULL},
+	{0x7d7ad807a3a0afd5ULL,0xb03f67f615ed2eb5ULL}, {0xe692391356c0e881ULL,0x34a12649d350c703ULL}, {0,0}, {0xb434ed1dd003e3f9ULL,0xb096df9257bae356ULL},
+	{0xff03a276663c3ea8ULL,0x6cdca30e1f1b206bULL}, {0xb391529cd548f17eULL,0x5f5b49e0786ae68dULL}, {0xea9225844b3bf2ecULL,0xb8872172e758d5e2ULL}, {0xe3e900e04c337927ULL,0xbe08951e9ef804dbULL},
+	{0x26dc18acfe4240fdULL,0x40c88a355a67bdc9ULL}, {0xbbe7e80fc6b48a64ULL,0xb5fe4bdee14ed0cbULL}, {0x8e574eacc4e82cfbULL,0xde7ea0d621a57adcULL}, {0x5c37b342a1fedec2ULL,0xfda5d3a9c9a44194ULL},
+	{0x90bb29b116e489dcULL,0xa796b6382e6bb778ULL}, {0,0}, {0,0}, {0,0},
+	{0,0}, {0,0}, {0,0}, {0,0},
+	{0,0}, {0,0}, {0,0}, {0,0},
+	{0,0}
+};
+
+// Positions that aren't on an edge, in order
+#define NUMINNER 64
+static const uint8_t inner[NUMINNER] = {
+	24, 25, 26, 27, 28, 29, 30, 31,
+	35, 36, 37, 38, 39, 40, 41, 42,
+	46, 47, 48, 49, 50, 51, 52, 53,
+	57, 58, 59, 60, 61, 62, 63, 64,
+	68, 69, 70, 71, 72, 73, 74, 75,
+	79, 80, 81, 82, 83, 84, 85, 86,
+	90, 91, 92, 93, 94, 95, 96, 97,
+	101, 102, 103, 104, 105, 106, 107, 108
+};
+
+// Positions along each edge: top, bottom, left, right
+static const uint8_t edges[4][10] = {
+	{12, 13, 14, 15, 16, 17, 18, 19, 20, 21},
+	{111, 112, 113, 114, 115, 116, 117, 118, 119, 120},
+	{12, 23, 34, 45, 56, 67, 78, 89, 100, 111},
+	{21, 32, 43, 54, 65, 76, 87, 98, 109, 120}
+};
+
+/* Stable pieces for each configuration of an edge, indexed as in
+	gentables.c; bit i is set if the i-th piece of the edge is stable. */
+static const uint16_t edgestable[59049] = {
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,992,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,992,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,1008,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,
+	512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,992,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,992,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,
+	512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,1008,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,992,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	768,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,992,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,1016,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,960,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,960,512,  0,768,768,  0,512,512,128,896,
+	896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,992,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,960,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,992,512,  0,768,768,  0,512,512,
+	128,896,896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	576,576, 64,960,960,192,960,960,  0,512,512,192,960,960,  0,960,
+	960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,960,512,  0,768,768,  0,512,
+	512,128,896,896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,
+	512,1008,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,992,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,
+	768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,992,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,1008,512,
+	  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,896,128,896,896,  0,512,
+	512,  0,768,768,  0,512,960,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,
+	960,192,960,960,  0,576,576,192,960,960, 64,960,960,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,896,128,896,896,  0,
+	512,512,  0,768,768,  0,512,992,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,992,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,896,128,896,
+	896,  0,512,512,  0,768,768,  0,512,960,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,960,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,1016,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,992,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,768,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,992,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,
+	768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,960,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,1008,512,  0,512,768,  0,512,512,  0,
+	768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,896,128,896,896,  0,512,512,  0,768,768,  0,512,960,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,960,960,192,960,960,  0,576,576,
+	192,960,960, 64,960,960,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,896,128,896,896,  0,512,512,  0,768,768,  0,512,
+	992,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,992,512,  0,512,768,  0,
+	512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,896,128,896,896,  0,512,512,  0,768,768,
+	  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,
+	  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,1008,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,992,512,  0,
+	512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,896,128,896,896,  0,512,512,
+	  0,768,768,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,
+	  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,992,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,
+	512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	1020,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,896,128,896,896,
+	  0,512,512,  0,768,768,  0,512,960,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,960,960,192,960,960,  0,576,576,192,960,960, 64,960,960,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,896,128,896,
+	896,  0,512,512,  0,768,768,  0,512,992,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,960,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,992,992,224,992,992,  0,608,608,224,992,992, 96,992,
+	992,  0,512,512,  0,800,544, 32,544,800, 32,608,608, 96,992,992,
+	224,992,992,  0,544,544,224,992,992, 32,992,992,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,960,960,192,960,960,  0,576,576,192,960,960, 64,
+	960,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	896,128,896,896,  0,512,512,  0,768,768,  0,512,1008,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,960,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,992,512,  0,512,768,  0,512,512,  0,768,
+	768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,896,128,896,896,  0,512,512,  0,768,768,  0,512,960,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,
+	768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,992,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,
+	  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,896,128,896,896,  0,512,512,  0,768,768,  0,512,
+	960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,1008,1008,240,1008,1008,  0,624,
+	624,240,1008,1008,112,1008,1008,  0,512,512,  0,816,560, 48,560,816,
+	 48,624,624,112,1008,1008,240,1008,1008,  0,560,560,240,1008,1008, 48,
+	1008,1008,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,912,
+	528, 16,784,784,  0,528,528,  0,784,784, 16,528,912,  0,528,528,
+	 48,816,560, 16,560,816, 16,560,560, 48,1008,1008,240,1008,1008, 48,
+	624,624,240,1008,1008,112,1008,1008,  0,512,512,  0,784,528, 16,528,
+	784, 16,624,624,112,1008,1008,240,1008,1008,  0,528,528,240,1008,1008,
+	 16,1008,1008,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,
+	  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,992,992,224,992,
+	992,  0,608,608,224,992,992, 96,992,992,  0,512,512,  0,800,544,
+	 32,544,800, 32,608,608, 96,992,992,224,992,992,  0,544,544,224,
+	992,992, 32,992,992,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,960,192,
+	960,960,  0,576,576,192,960,960, 64,960,960,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,896,128,896,896,  0,512,512,
+	  0,768,768,  0,512,1016,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,992,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,
+	512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,992,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,1008,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	768,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,960,512,  0,768,768,  0,512,512,128,896,896,  0,896,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,768,768,  0,512,512,  0,768,512,  0,512,992,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,768,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,992,512,  0,768,768,  0,512,512,128,896,896,
+	  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,576,576, 64,
+	960,960,192,960,960,  0,512,512,192,960,960,  0,960,960,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,960,512,  0,768,768,  0,512,512,128,896,
+	896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,1008,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,960,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,992,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,
+	960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,960,512,  0,768,768,  0,512,
+	512,128,896,896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,
+	512,992,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,
+	  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,1016,512,  0,768,768,
+	  0,512,512,128,896,896,  0,896,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,576,576, 64,960,960,192,960,960,  0,512,512,192,960,
+	960,  0,960,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512, 32,800,544,  0,544,800,  0,544,544, 32,992,992,224,992,
+	992, 32,608,608,224,992,992, 96,992,992,  0,512,512,  0,768,512,
+	  0,512,768,  0,608,608, 96,992,992,224,992,992,  0,512,512,224,
+	992,992,  0,992,992,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,
+	768,768,  0,512,512,128,896,896,  0,896,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,
+	  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,
+	528,528, 16,912,528,  0,784,784,  0,512,512, 16,784,784,  0,528,
+	912,  0,512,512, 16,784,528,  0,528,784,  0,528,528, 16,1008,1008,
+	240,1008,1008, 16,624,624,240,1008,1008,112,1008,1008,  0,528,528, 16,
+	816,560, 48,560,816, 48,624,624,112,1008,1008,240,1008,1008, 16,560,
+	560,240,1008,1008, 48,1008,1008,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512, 48,816,560,  0,560,816,  0,560,560, 48,1008,
+	1008,240,1008,1008, 48,624,624,240,1008,1008,112,1008,1008,  0,512,512,
+	  0,768,512,  0,512,768,  0,624,624,112,1008,1008,240,1008,1008,  0,
+	512,512,240,1008,1008,  0,1008,1008,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,992,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,
+	768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,960,512,  0,768,768,  0,512,512,128,896,896,  0,896,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	768,768,  0,512,512,  0,768,512,  0,512,992,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,768,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,1008,512,  0,768,768,  0,512,512,128,896,896,  0,
+	896,896,  0,512,512,  0,768,512,  0,512,768,  0,576,576, 64,960,
+	960,192,960,960,  0,512,512,192,960,960,  0,960,960,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512, 32,800,544,  0,544,
+	800,  0,544,544, 32,992,992,224,992,992, 32,608,608,224,992,992,
+	 96,992,992,  0,512,512,  0,768,512,  0,512,768,  0,608,608, 96,
+	992,992,224,992,992,  0,512,512,224,992,992,  0,992,992,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,960,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,992,512,  0,768,768,  0,512,512,128,
+	896,896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,576,
+	576, 64,960,960,192,960,960,  0,512,512,192,960,960,  0,960,960,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,960,512,  0,768,768,  0,512,512,
+	128,896,896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,
+	1020,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,992,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,
+	  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,992,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,1008,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,
+	  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,
+	  0,768,768,  0,512,512,128,896,896,  0,896,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,
+	512,  0,768,512,  0,512,992,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,
+	512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	992,512,  0,768,768,  0,512,512,128,896,896,  0,896,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,576,576, 64,960,960,192,960,960,
+	  0,512,512,192,960,960,  0,960,960,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,960,512,  0,768,768,  0,512,512,128,896,896,  0,896,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,
+	768,  0,512,512,  0,768,512,  0,512,1008,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	768,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,992,512,  0,768,768,  0,512,512,128,896,896,  0,896,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,576,576, 64,960,960,
+	192,960,960,  0,512,512,192,960,960,  0,960,960,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,960,512,  0,768,768,  0,512,512,128,896,896,  0,
+	896,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,768,768,  0,512,512,  0,768,512,  0,512,992,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,960,512,  0,768,768,  0,512,512,128,896,896,
+	  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,960,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,1016,512,  0,768,768,  0,512,512,128,896,
+	896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,576,576,
+	 64,960,960,192,960,960,  0,512,512,192,960,960,  0,960,960,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512, 32,800,544,
+	  0,544,800,  0,544,544, 32,992,992,224,992,992, 32,608,608,224,
+	992,992, 96,992,992,  0,512,512,  0,768,512,  0,512,768,  0,608,
+	608, 96,992,992,224,992,992,  0,512,512,224,992,992,  0,992,992,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,960,512,  0,768,768,  0,512,512,
+	128,896,896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,
+	960,  0,512,512,  0,768,512,  0,512,768,  0,528,528, 16,912,528,
+	  0,784,784,  0,512,512, 16,784,784,  0,528,912,  0,512,512, 16,
+	784,528,  0,528,784,  0,528,528, 16,1008,1008,240,1008,1008, 16,624,
+	624,240,1008,1008,112,1008,1008,  0,528,528, 16,816,560, 48,560,816,
+	 48,624,624,112,1008,1008,240,1008,1008, 16,560,560,240,1008,1008, 48,
+	1008,1008,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,768,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	 48,816,560,  0,560,816,  0,560,560, 48,1008,1008,240,1008,1008, 48,
+	624,624,240,1008,1008,112,1008,1008,  0,512,512,  0,768,512,  0,512,
+	768,  0,624,624,112,1008,1008,240,1008,1008,  0,512,512,240,1008,1008,
+	  0,1008,1008,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,992,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,  0,
+	768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,
+	768,768,  0,512,512,128,896,896,  0,896,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,
+	  0,768,512,  0,512,992,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,
+	512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,1008,
+	512,  0,768,768,  0,512,512,128,896,896,  0,896,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,576,576, 64,960,960,192,960,960,  0,
+	512,512,192,960,960,  0,960,960,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512, 32,800,544,  0,544,800,  0,544,544, 32,
+	992,992,224,992,992, 32,608,608,224,992,992, 96,992,992,  0,512,
+	512,  0,768,512,  0,512,768,  0,608,608, 96,992,992,224,992,992,
+	  0,512,512,224,992,992,  0,992,992,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,
+	768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,992,512,  0,768,768,  0,512,512,128,896,896,  0,896,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,576,576, 64,960,960,192,
+	960,960,  0,512,512,192,960,960,  0,960,960,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,960,512,  0,768,768,  0,512,512,128,896,896,  0,896,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,768,768,  0,512,512,  0,768,512,  0,512,1016,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,992,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,960,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,960,512,  0,768,768,  0,512,512,128,896,
+	896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,992,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,960,512,  0,768,768,  0,512,512,128,
+	896,896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,960,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	768,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,1008,512,  0,768,768,  0,512,512,
+	128,896,896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	576,576, 64,960,960,192,960,960,  0,512,512,192,960,960,  0,960,
+	960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,768,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512, 32,
+	800,544,  0,544,800,  0,544,544, 32,992,992,224,992,992, 32,608,
+	608,224,992,992, 96,992,992,  0,512,512,  0,768,512,  0,512,768,
+	  0,608,608, 96,992,992,224,992,992,  0,512,512,224,992,992,  0,
+	992,992,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,
+	  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,992,512,  0,768,768,
+	  0,512,512,128,896,896,  0,896,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,576,576, 64,960,960,192,960,960,  0,512,512,192,960,
+	960,  0,960,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,768,
+	768,  0,512,512,128,896,896,  0,896,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,  0,
+	768,512,  0,512,1008,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,
+	  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,992,512,
+	  0,768,768,  0,512,512,128,896,896,  0,896,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,576,576, 64,960,960,192,960,960,  0,512,
+	512,192,960,960,  0,960,960,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,
+	512,  0,768,768,  0,512,512,128,896,896,  0,896,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,
+	512,512,  0,768,512,  0,512,992,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	960,512,  0,768,768,  0,512,512,128,896,896,  0,896,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,
+	  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,1022,512,  0,768,768,  0,512,512,128,896,896,  0,896,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,576,576, 64,960,960,192,960,
+	960,  0,512,512,192,960,960,  0,960,960,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512, 32,800,544,  0,544,800,  0,544,
+	544, 32,992,992,224,992,992, 32,608,608,224,992,992, 96,992,992,
+	  0,512,512,  0,768,512,  0,512,768,  0,608,608, 96,992,992,224,
+	992,992,  0,512,512,224,992,992,  0,992,992,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,960,512,  0,768,768,  0,512,512,128,896,896,  0,896,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,768,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,
+	768,512,  0,512,768,  0,528,528, 16,912,528,  0,784,784,  0,512,
+	512, 16,784,784,  0,528,912,  0,512,512, 16,784,528,  0,528,784,
+	  0,528,528, 16,1008,1008,240,1008,1008, 16,624,624,240,1008,1008,112,
+	1008,1008,  0,528,528, 16,816,560, 48,560,816, 48,624,624,112,1008,
+	1008,240,1008,1008, 16,560,560,240,1008,1008, 48,1008,1008,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512, 48,816,560,  0,560,
+	816,  0,560,560, 48,1008,1008,240,1008,1008, 48,624,624,240,1008,1008,
+	112,1008,1008,  0,512,512,  0,768,512,  0,512,768,  0,624,624,112,
+	1008,1008,240,1008,1008,  0,512,512,240,1008,1008,  0,1008,1008,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,960,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,992,512,  0,768,768,  0,512,512,128,
+	896,896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,576,
+	576, 64,960,960,192,960,960,  0,512,512,192,960,960,  0,960,960,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,960,512,  0,768,768,  0,512,512,
+	128,896,896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,
+	992,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  8,
+	776,520,  0,520,776,  0,520,520,  8,968,520,  0,776,776,  0,512,
+	512,136,904,904,  0,904,904,  0,512,512,  0,768,512,  0,512,768,
+	  0,520,520,  8,904,904,136,904,904,  0,512,512,  8,776,776,  0,
+	520,968,  0,512,512,  0,768,512,  0,512,768,  0,520,520,  8,904,
+	520,  0,776,776,  0,512,512,  8,776,776,  0,520,904,  0,512,512,
+	  8,776,520,  0,520,776,  0,520,520,  8,1016,1016,248,1016,1016,  8,
+	632,632,248,1016,1016,120,1016,1016,  0,520,520,  8,824,568, 56,568,
+	824, 56,632,632,120,1016,1016,248,1016,1016,  8,568,568,248,1016,1016,
+	 56,1016,1016,  0,512,512,  8,776,520,  0,520,776,  0,520,520,  8,
+	920,536, 24,792,792,  8,536,536,  8,792,792, 24,536,920,  8,536,
+	536, 56,824,568, 24,568,824, 24,568,568, 56,1016,1016,248,1016,1016,
+	 56,632,632,248,1016,1016,120,1016,1016,  0,520,520,  8,792,536, 24,
+	536,792, 24,632,632,120,1016,1016,248,1016,1016,  8,536,536,248,1016,
+	1016, 24,1016,1016,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,768,
+	768,  0,512,512,128,896,896,  0,896,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,  0,
+	768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,536,
+	536, 24,920,536,  0,792,792,  0,512,512, 24,792,792,  0,536,920,
+	  0,512,512, 24,792,536,  0,536,792,  0,536,536, 24,1016,1016,248,
+	1016,1016, 24,632,632,248,1016,1016,120,1016,1016,  0,536,536, 24,824,
+	568, 56,568,824, 56,632,632,120,1016,1016,248,1016,1016, 24,568,568,
+	248,1016,1016, 56,1016,1016,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512, 56,824,568,  0,568,824,  0,568,568, 56,1016,1016,
+	248,1016,1016, 56,632,632,248,1016,1016,120,1016,1016,  0,512,512,  0,
+	768,512,  0,512,768,  0,632,632,120,1016,1016,248,1016,1016,  0,512,
+	512,248,1016,1016,  0,1016,1016,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	992,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,
+	  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,960,512,  0,768,768,  0,512,512,128,896,896,  0,896,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,
+	768,  0,512,512,  0,768,512,  0,512,992,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,960,512,  0,768,768,  0,512,512,128,896,896,  0,896,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	768,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,1008,512,  0,768,768,  0,512,512,128,896,896,  0,896,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,576,576, 64,960,960,
+	192,960,960,  0,512,512,192,960,960,  0,960,960,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512, 32,800,544,  0,544,800,
+	  0,544,544, 32,992,992,224,992,992, 32,608,608,224,992,992, 96,
+	992,992,  0,512,512,  0,768,512,  0,512,768,  0,608,608, 96,992,
+	992,224,992,992,  0,512,512,224,992,992,  0,992,992,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,960,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,992,512,  0,768,768,  0,512,512,128,896,
+	896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,576,576,
+	 64,960,960,192,960,960,  0,512,512,192,960,960,  0,960,960,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,960,512,  0,768,768,  0,512,512,128,
+	896,896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,1008,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,
+	  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,
+	960,  0,512,512,  0,768,512,  0,512,768,  0,516,516,  4,900,516,
+	  0,772,772,  0,512,512,  4,772,516,  0,516,900,  0,512,512,  4,
+	772,516,  0,516,772,  0,516,516,  4,996,516,  0,772,772,  0,512,
+	512,132,900,900,  0,900,900,  0,512,512,  0,768,512,  0,512,768,
+	  0,580,580, 68,964,964,196,964,964,  0,512,512,196,964,964,  0,
+	964,964,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  4,772,516,  0,516,772,  0,516,516,  4,964,964,196,964,964,  4,
+	580,580,196,964,964, 68,964,964,  0,512,512,  0,768,512,  0,512,
+	768,  0,516,516,  4,900,900,132,900,900,  0,512,512,  4,772,772,
+	  0,516,996,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  4,772,516,  0,516,772,  0,516,516,  4,964,516,  0,772,772,
+	  0,512,512,132,900,900,  0,900,900,  0,512,512,  0,768,512,  0,
+	512,768,  0,516,516,  4,900,900,132,900,900,  0,512,512,  4,772,
+	772,  0,516,964,  0,512,512,  0,768,512,  0,512,768,  0,516,516,
+	  4,900,516,  0,772,772,  0,512,512,  4,772,772,  0,516,900,  0,
+	512,512,  4,772,516,  0,516,772,  0,516,516,  4,1020,1020,252,1020,
+	1020,  4,636,636,252,1020,1020,124,1020,1020,  0,516,516,  4,828,572,
+	 60,572,828, 60,636,636,124,1020,1020,252,1020,1020,  4,572,572,252,
+	1020,1020, 60,1020,1020,  0,512,512,  4,772,516,  0,516,772,  0,516,
+	516,  4,924,540, 28,796,796,  4,540,540,  4,796,796, 28,540,924,
+	  4,540,540, 60,828,572, 28,572,828, 28,572,572, 60,1020,1020,252,
+	1020,1020, 60,636,636,252,1020,1020,124,1020,1020,  0,516,516,  4,796,
+	540, 28,540,796, 28,636,636,124,1020,1020,252,1020,1020,  4,540,540,
+	252,1020,1020, 28,1020,1020,  0,512,512,  0,768,512,  0,512,768,  0,
+	516,516,  4,900,516,  0,516,772,  0,512,512,  4,772,516,  0,516,
+	900,  0,512,512,  4,772,516,  0,516,772,  0,516,516,  4,972,524,
+	 12,780,780,  4,524,524,140,908,908, 12,908,908,  0,516,516,  4,
+	780,524, 12,524,780,  0,516,516,  4,908,908,140,908,908,  4,524,
+	524,  4,780,780, 12,524,972,  0,516,516,  4,780,524, 12,524,780,
+	 12,540,540, 28,924,540, 12,796,796,  4,524,524, 28,796,796, 12,
+	540,924,  4,524,524, 28,796,540, 12,540,796, 12,540,540, 28,1020,
+	1020,252,1020,1020, 28,636,636,252,1020,1020,124,1020,1020, 12,540,540,
+	 28,828,572, 60,572,828, 60,636,636,124,1020,1020,252,1020,1020, 28,
+	572,572,252,1020,1020, 60,1020,1020,  0,512,512,  4,772,516,  0,516,
+	772,  0,516,516,  4,908,524, 12,780,780,  4,524,524,  4,780,780,
+	 12,524,908,  4,524,524, 60,828,572, 12,572,828, 12,572,572, 60,
+	1020,1020,252,1020,1020, 60,636,636,252,1020,1020,124,1020,1020,  0,516,
+	516,  4,780,524, 12,524,780, 12,636,636,124,1020,1020,252,1020,1020,
+	  4,524,524,252,1020,1020, 12,1020,1020,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,768,
+	768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,768,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,992,512,  0,768,768,  0,512,512,128,896,896,  0,896,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,576,576, 64,960,960,192,
+	960,960,  0,512,512,192,960,960,  0,960,960,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,960,512,  0,768,768,  0,512,512,128,896,896,  0,896,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,768,768,  0,512,512,  0,768,512,  0,512,992,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512, 12,780,524,  0,524,780,
+	  0,524,524, 12,972,524,  0,780,780,  0,512,512,140,908,908,  0,
+	908,908,  0,512,512,  0,768,512,  0,512,768,  0,524,524, 12,908,
+	908,140,908,908,  0,512,512, 12,780,780,  0,524,972,  0,512,512,
+	  0,768,512,  0,512,768,  0,524,524, 12,908,524,  0,780,780,  0,
+	512,512, 12,780,780,  0,524,908,  0,512,512, 12,780,524,  0,524,
+	780,  0,524,524, 12,1020,1020,252,1020,1020, 12,636,636,252,1020,1020,
+	124,1020,1020,  0,524,524, 12,828,572, 60,572,828, 60,636,636,124,
+	1020,1020,252,1020,1020, 12,572,572,252,1020,1020, 60,1020,1020,  0,512,
+	512, 12,780,524,  0,524,780,  0,524,524, 12,924,540, 28,796,796,
+	 12,540,540, 12,796,796, 28,540,924, 12,540,540, 60,828,572, 28,
+	572,828, 28,572,572, 60,1020,1020,252,1020,1020, 60,636,636,252,1020,
+	1020,124,1020,1020,  0,524,524, 12,796,540, 28,540,796, 28,636,636,
+	124,1020,1020,252,1020,1020, 12,540,540,252,1020,1020, 28,1020,1020,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,960,512,  0,768,768,  0,512,512,128,
+	896,896,  0,896,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,960,
+	  0,512,512,  0,768,512,  0,512,768,  0,540,540, 28,924,540,  0,
+	796,796,  0,512,512, 28,796,796,  0,540,924,  0,512,512, 28,796,
+	540,  0,540,796,  0,540,540, 28,1020,1020,252,1020,1020, 28,636,636,
+	252,1020,1020,124,1020,1020,  0,540,540, 28,828,572, 60,572,828, 60,
+	636,636,124,1020,1020,252,1020,1020, 28,572,572,252,1020,1020, 60,1020,
+	1020,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,768,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512, 60,
+	828,572,  0,572,828,  0,572,572, 60,1020,1020,252,1020,1020, 60,636,
+	636,252,1020,1020,124,1020,1020,  0,512,512,  0,768,512,  0,512,768,
+	  0,636,636,124,1020,1020,252,1020,1020,  0,512,512,252,1020,1020,  0,
+	1020,1020,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,992,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,
+	768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,992,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,
+	512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,1008,512,
+	  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,896,128,896,896,  0,512,
+	512,  0,768,768,  0,512,960,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,
+	960,192,960,960,  0,576,576,192,960,960, 64,960,960,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,896,128,896,896,  0,
+	512,512,  0,768,768,  0,512,992,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,992,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,896,128,896,
+	896,  0,512,512,  0,768,768,  0,512,960,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,960,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,1008,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,992,512,  0,512,768,  0,512,512,  0,768,768,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	896,128,896,896,  0,512,512,  0,768,768,  0,512,960,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,768,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,992,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,
+	768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,960,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,1016,512,  0,512,768,  0,512,512,  0,
+	768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,896,128,896,896,  0,512,512,  0,768,768,  0,512,960,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,960,960,192,960,960,  0,576,576,
+	192,960,960, 64,960,960,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,896,128,896,896,  0,512,512,  0,768,768,  0,512,
+	992,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,
+	512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,992,992,224,992,992,  0,
+	608,608,224,992,992, 96,992,992,  0,512,512,  0,800,544, 32,544,
+	800, 32,608,608, 96,992,992,224,992,992,  0,544,544,224,992,992,
+	 32,992,992,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,960,960,192,960,960,
+	  0,576,576,192,960,960, 64,960,960,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,896,128,896,896,  0,512,512,  0,768,
+	768,  0,512,1008,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,
+	768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,992,512,  0,
+	512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,896,128,896,896,  0,512,512,
+	  0,768,768,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,768,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,960,
+	192,960,960,  0,576,576,192,960,960, 64,960,960,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,896,128,896,896,  0,512,
+	512,  0,768,768,  0,512,992,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,
+	512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,896,128,896,896,  0,
+	512,512,  0,768,768,  0,512,960,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,768,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	1008,1008,240,1008,1008,  0,624,624,240,1008,1008,112,1008,1008,  0,512,
+	512,  0,816,560, 48,560,816, 48,624,624,112,1008,1008,240,1008,1008,
+	  0,560,560,240,1008,1008, 48,1008,1008,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,912,528, 16,784,784,  0,528,528,  0,784,
+	784, 16,528,912,  0,528,528, 48,816,560, 16,560,816, 16,560,560,
+	 48,1008,1008,240,1008,1008, 48,624,624,240,1008,1008,112,1008,1008,  0,
+	512,512,  0,784,528, 16,528,784, 16,624,624,112,1008,1008,240,1008,
+	1008,  0,528,528,240,1008,1008, 16,1008,1008,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,960,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,896,128,
+	896,896,  0,512,512,  0,768,768,  0,512,960,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,992,992,224,992,992,  0,608,608,224,992,992, 96,992,
+	992,  0,512,512,  0,800,544, 32,544,800, 32,608,608, 96,992,992,
+	224,992,992,  0,544,544,224,992,992, 32,992,992,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,960,960,192,960,960,  0,576,576,192,960,960, 64,
+	960,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	896,128,896,896,  0,512,512,  0,768,768,  0,512,1016,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,960,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,992,512,  0,512,768,  0,512,512,  0,768,
+	768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,896,128,896,896,  0,512,512,  0,768,768,  0,512,960,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,
+	768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,992,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,
+	  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,1008,512,  0,512,768,  0,512,
+	512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,896,128,896,896,  0,512,512,  0,768,768,  0,
+	512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,960,960,192,960,960,  0,
+	576,576,192,960,960, 64,960,960,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,896,128,896,896,  0,512,512,  0,768,768,
+	  0,512,992,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,
+	  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,896,128,896,896,  0,512,512,  0,768,
+	768,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,992,992,224,992,
+	992,  0,608,608,224,992,992, 96,992,992,  0,512,512,  0,800,544,
+	 32,544,800, 32,608,608, 96,992,992,224,992,992,  0,544,544,224,
+	992,992, 32,992,992,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,960,192,
+	960,960,  0,576,576,192,960,960, 64,960,960,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,896,128,896,896,  0,512,512,
+	  0,768,768,  0,512,1008,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,
+	  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,992,
+	512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,896,128,896,896,  0,
+	512,512,  0,768,768,  0,512,960,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,768,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	960,960,192,960,960,  0,576,576,192,960,960, 64,960,960,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,896,128,896,896,
+	  0,512,512,  0,768,768,  0,512,992,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,960,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,896,128,896,
+	896,  0,512,512,  0,768,768,  0,512,960,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,1020,1020,252,1020,1020,  0,636,636,252,1020,1020,124,1020,1020,
+	  0,512,512,  0,828,572, 60,572,828, 60,636,636,124,1020,1020,252,
+	1020,1020,  0,572,572,252,1020,1020, 60,1020,1020,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,924,540, 28,796,796,  0,540,540,
+	  0,796,796, 28,540,924,  0,540,540, 60,828,572, 28,572,828, 28,
+	572,572, 60,1020,1020,252,1020,1020, 60,636,636,252,1020,1020,124,1020,
+	1020,  0,512,512,  0,796,540, 28,540,796, 28,636,636,124,1020,1020,
+	252,1020,1020,  0,540,540,252,1020,1020, 28,1020,1020,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,972,524, 12,780,780,  0,524,524,140,908,908, 12,
+	908,908,  0,512,512,  0,780,524, 12,524,780,  0,512,512,  0,908,
+	908,140,908,908,  0,524,524,  0,780,780, 12,524,972,  0,512,512,
+	  0,780,524, 12,524,780, 12,540,540, 28,924,540, 12,796,796,  0,
+	524,524, 28,796,796, 12,540,924,  0,524,524, 28,796,540, 12,540,
+	796, 12,540,540, 28,1020,1020,252,1020,1020, 28,636,636,252,1020,1020,
+	124,1020,1020, 12,540,540, 28,828,572, 60,572,828, 60,636,636,124,
+	1020,1020,252,1020,1020, 28,572,572,252,1020,1020, 60,1020,1020,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,908,524, 12,780,780,
+	  0,524,524,  0,780,780, 12,524,908,  0,524,524, 60,828,572, 12,
+	572,828, 12,572,572, 60,1020,1020,252,1020,1020, 60,636,636,252,1020,
+	1020,124,1020,1020,  0,512,512,  0,780,524, 12,524,780, 12,636,636,
+	124,1020,1020,252,1020,1020,  0,524,524,252,1020,1020, 12,1020,1020,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,
+	768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,768,768,  0,512,512,  0,768,512,  0,512,960,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,996,516,  4,772,772,  0,516,516,
+	132,900,900,  4,900,900,  0,512,512,  0,772,516,  4,516,772,  4,
+	580,580, 68,964,964,196,964,964,  0,516,516,196,964,964,  4,964,
+	964,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,900,516,
+	  4,516,772,  0,516,516,  0,772,772,  4,516,900,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,964,964,196,964,964,  0,580,
+	580,196,964,964, 68,964,964,  0,512,512,  0,772,516,  4,516,772,
+	  0,512,512,  0,900,900,132,900,900,  0,516,516,  0,772,772,  4,
+	516,996,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,900,
+	516,  4,516,772,  0,516,516,  0,772,516,  4,516,900,  0,516,516,
+	 12,780,524,  4,524,780,  4,524,524, 12,972,524,  4,780,780,  0,
+	516,516,140,908,908,  4,908,908,  0,512,512,  0,772,516,  4,516,
+	772,  4,524,524, 12,908,908,140,908,908,  0,516,516, 12,780,780,
+	  4,524,972,  0,512,512,  0,772,516,  4,516,772,  4,524,524, 12,
+	908,524,  4,780,780,  0,516,516, 12,780,780,  4,524,908,  0,516,
+	516, 12,780,524,  4,524,780,  4,524,524, 12,1020,1020,252,1020,1020,
+	 12,636,636,252,1020,1020,124,1020,1020,  4,524,524, 12,828,572, 60,
+	572,828, 60,636,636,124,1020,1020,252,1020,1020, 12,572,572,252,1020,
+	1020, 60,1020,1020,  0,516,516, 12,780,524,  4,524,780,  4,524,524,
+	 12,924,540, 28,796,796, 12,540,540, 12,796,796, 28,540,924, 12,
+	540,540, 60,828,572, 28,572,828, 28,572,572, 60,1020,1020,252,1020,
+	1020, 60,636,636,252,1020,1020,124,1020,1020,  4,524,524, 12,796,540,
+	 28,540,796, 28,636,636,124,1020,1020,252,1020,1020, 12,540,540,252,
+	1020,1020, 28,1020,1020,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,964,516,  4,
+	772,772,  0,516,516,132,900,900,  4,900,900,  0,512,512,  0,772,
+	516,  4,516,772,  0,512,512,  0,900,900,132,900,900,  0,516,516,
+	  0,772,772,  4,516,964,  0,512,512,  0,772,516,  4,516,772,  4,
+	540,540, 28,924,540,  4,796,796,  0,516,516, 28,796,796,  4,540,
+	924,  0,516,516, 28,796,540,  4,540,796,  4,540,540, 28,1020,1020,
+	252,1020,1020, 28,636,636,252,1020,1020,124,1020,1020,  4,540,540, 28,
+	828,572, 60,572,828, 60,636,636,124,1020,1020,252,1020,1020, 28,572,
+	572,252,1020,1020, 60,1020,1020,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,900,516,  4,772,772,  0,516,516,  0,772,772,  4,
+	516,900,  0,516,516, 60,828,572,  4,572,828,  4,572,572, 60,1020,
+	1020,252,1020,1020, 60,636,636,252,1020,1020,124,1020,1020,  0,512,512,
+	  0,772,516,  4,516,772,  4,636,636,124,1020,1020,252,1020,1020,  0,
+	516,516,252,1020,1020,  4,1020,1020,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	960,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,
+	512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,992,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,896,128,896,
+	896,  0,512,512,  0,768,768,  0,512,960,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,960,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,992,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,768,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,1008,512,  0,512,768,  0,512,512,  0,768,768,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	896,128,896,896,  0,512,512,  0,768,768,  0,512,960,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,960,960,192,960,960,  0,576,576,192,960,960,
+	 64,960,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,896,128,896,896,  0,512,512,  0,768,768,  0,512,992,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,
+	768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,896,128,896,896,  0,512,512,  0,768,768,  0,512,960,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,
+	768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,992,992,224,992,992,  0,608,608,224,
+	992,992, 96,992,992,  0,512,512,  0,800,544, 32,544,800, 32,608,
+	608, 96,992,992,224,992,992,  0,544,544,224,992,992, 32,992,992,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,960,960,192,960,960,  0,576,576,
+	192,960,960, 64,960,960,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,896,128,896,896,  0,512,512,  0,768,768,  0,512,
+	1008,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,
+	512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,992,512,  0,512,768,  0,
+	512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,896,128,896,896,  0,512,512,  0,768,768,
+	  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,960,960,192,960,960,
+	  0,576,576,192,960,960, 64,960,960,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,896,896,128,896,896,  0,512,512,  0,768,
+	768,  0,512,992,  0,512,512,  0,768,512,  0,512,768,  0,512,512,
+	  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,512,896,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,960,512,  0,512,
+	768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,896,128,896,896,  0,512,512,  0,
+	768,768,  0,512,960,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,896,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,1016,1016,248,
+	1016,1016,  0,632,632,248,1016,1016,120,1016,1016,  0,512,512,  0,824,
+	568, 56,568,824, 56,632,632,120,1016,1016,248,1016,1016,  0,568,568,
+	248,1016,1016, 56,1016,1016,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,920,536, 24,792,792,  0,536,536,  0,792,792, 24,536,
+	920,  0,536,536, 56,824,568, 24,568,824, 24,568,568, 56,1016,1016,
+	248,1016,1016, 56,632,632,248,1016,1016,120,1016,1016,  0,512,512,  0,
+	792,536, 24,536,792, 24,632,632,120,1016,1016,248,1016,1016,  0,536,
+	536,248,1016,1016, 24,1016,1016,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,768,512,  0,
+	512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,968,
+	520,  8,776,776,  0,520,520,136,904,904,  8,904,904,  0,512,512,
+	  0,776,520,  8,520,776,  0,512,512,  0,904,904,136,904,904,  0,
+	520,520,  0,776,776,  8,520,968,  0,512,512,  0,776,520,  8,520,
+	776,  8,536,536, 24,920,536,  8,792,792,  0,520,520, 24,792,792,
+	  8,536,920,  0,520,520, 24,792,536,  8,536,792,  8,536,536, 24,
+	1016,1016,248,1016,1016, 24,632,632,248,1016,1016,120,1016,1016,  8,536,
+	536, 24,824,568, 56,568,824, 56,632,632,120,1016,1016,248,1016,1016,
+	 24,568,568,248,1016,1016, 56,1016,1016,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,904,520,  8,776,776,  0,520,520,  0,776,
+	776,  8,520,904,  0,520,520, 56,824,568,  8,568,824,  8,568,568,
+	 56,1016,1016,248,1016,1016, 56,632,632,248,1016,1016,120,1016,1016,  0,
+	512,512,  0,776,520,  8,520,776,  8,632,632,120,1016,1016,248,1016,
+	1016,  0,520,520,248,1016,1016,  8,1016,1016,  0,512,512,  0,768,512,
+	  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,  0,
+	768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,
+	512,  0,960,512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,960,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,512,
+	  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,992,512,  0,512,768,  0,512,512,  0,768,768,  0,512,
+	896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,896,
+	128,896,896,  0,512,512,  0,768,768,  0,512,960,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,512,
+	512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,
+	  0,512,512,  0,960,960,192,960,960,  0,576,576,192,960,960, 64,
+	960,960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	896,128,896,896,  0,512,512,  0,768,768,  0,512,992,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,  0,
+	512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,  0,768,768,
+	  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,
+	896,896,128,896,896,  0,512,512,  0,768,768,  0,512,960,  0,512,
+	512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,512,768,
+	  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,
+	512,768,  0,512,512,  0,1008,1008,240,1008,1008,  0,624,624,240,1008,
+	1008,112,1008,1008,  0,512,512,  0,816,560, 48,560,816, 48,624,624,
+	112,1008,1008,240,1008,1008,  0,560,560,240,1008,1008, 48,1008,1008,  0,
+	512,512,  0,768,512,  0,512,768,  0,512,512,  0,912,528, 16,784,
+	784,  0,528,528,  0,784,784, 16,528,912,  0,528,528, 48,816,560,
+	 16,560,816, 16,560,560, 48,1008,1008,240,1008,1008, 48,624,624,240,
+	1008,1008,112,1008,1008,  0,512,512,  0,784,528, 16,528,784, 16,624,
+	624,112,1008,1008,240,1008,1008,  0,528,528,240,1008,1008, 16,1008,1008,
+	  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,  0,
+	512,768,  0,512,512,  0,768,512,  0,512,896,  0,512,512,  0,768,
+	512,  0,512,768,  0,512,512,  0,960,512,  0,512,768,  0,512,512,
+	  0,768,768,  0,512,896,  0,512,512,  0,768,512,  0,512,768,  0,
+	512,512,  0,896,896,128,896,896,  0,512,512,  0,768,768,  0,512,
+	960,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,512,
+	  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,  0,
+	768,512,  0,512,768,  0,512,512,  0,992,992,224,992,992,  0,608,
+	608,224,992,992, 96,992,992,  0,512,512,  0,800,544, 32,544,800,
+	 32,608,608, 96,992,992,224,992,992,  0,544,544,224,992,992, 32,
+	992,992,  0,512,512,  0,768,512,  0,512,768,  0,512,512,  0,896,
+	512,  0,512,768,  0,512,512,  0,768,768,  0,512,896,  0,512,512,
+	  0,768,512,  0,512,768,  0,512,512,  0,960,960,192,960,960,  0,
+	576,576,192,960,960, 64,960,960,  0,512,512,  0,768,512,  0,512,
+	768,  0,512,512,  0,896,896,128,896,896,  0,512,512,  0,768,768,
+	  0,512,1022,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,993,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,993,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,1009,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,
+	513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	961,513,  1,769,769,  1,513,513,129,897,897,  1,897,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,
+	  1,513,513,  1,769,513,  1,513,993,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,961,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,993,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,897,129,
+	897,897,  1,513,513,  1,769,769,  1,513,961,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,769,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,1009,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,993,513,  1,513,769,  1,513,513,  1,769,769,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,897,129,897,897,  1,513,513,  1,769,769,  1,513,961,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,
+	769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,993,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,
+	769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,961,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,1017,513,  1,513,769,  1,513,513,
+	  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,513,
+	961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,961,961,193,961,961,  1,577,
+	577,193,961,961, 65,961,961,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,
+	513,993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,
+	513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,993,993,225,993,993,
+	  1,609,609,225,993,993, 97,993,993,  1,513,513,  1,801,545, 33,
+	545,801, 33,609,609, 97,993,993,225,993,993,  1,545,545,225,993,
+	993, 33,993,993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,961,193,961,
+	961,  1,577,577,193,961,961, 65,961,961,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,
+	769,769,  1,513,1009,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,993,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,
+	513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,
+	513,  1,769,769,  1,513,513,129,897,897,  1,897,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,
+	513,513,  1,769,513,  1,513,993,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	961,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,
+	  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,1009,513,  1,769,769,  1,513,513,129,897,897,  1,897,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,577,577, 65,961,961,193,961,
+	961,  1,513,513,193,961,961,  1,961,961,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513, 33,801,545,  1,545,801,  1,545,
+	545, 33,993,993,225,993,993, 33,609,609,225,993,993, 97,993,993,
+	  1,513,513,  1,769,513,  1,513,769,  1,609,609, 97,993,993,225,
+	993,993,  1,513,513,225,993,993,  1,993,993,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,769,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,993,513,  1,769,769,  1,513,513,129,897,897,  1,
+	897,897,  1,513,513,  1,769,513,  1,513,769,  1,577,577, 65,961,
+	961,193,961,961,  1,513,513,193,961,961,  1,961,961,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,129,897,897,
+	  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,1017,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,961,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,993,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,961,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,
+	129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,
+	993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,961,513,  1,769,769,  1,513,
+	513,129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,
+	513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,769,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,1009,513,  1,769,769,  1,
+	513,513,129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,577,577, 65,961,961,193,961,961,  1,513,513,193,961,961,
+	  1,961,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513, 33,801,545,  1,545,801,  1,545,545, 33,993,993,225,993,993,
+	 33,609,609,225,993,993, 97,993,993,  1,513,513,  1,769,513,  1,
+	513,769,  1,609,609, 97,993,993,225,993,993,  1,513,513,225,993,
+	993,  1,993,993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,
+	769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,993,513,  1,
+	769,769,  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,577,577, 65,961,961,193,961,961,  1,513,513,
+	193,961,961,  1,961,961,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,
+	  1,769,769,  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,
+	513,  1,769,513,  1,513,1009,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,
+	513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	993,513,  1,769,769,  1,513,513,129,897,897,  1,897,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,577,577, 65,961,961,193,961,961,
+	  1,513,513,193,961,961,  1,961,961,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,961,513,  1,769,769,  1,513,513,129,897,897,  1,897,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,
+	769,  1,513,513,  1,769,513,  1,513,993,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,961,513,  1,769,769,  1,513,513,129,897,897,  1,897,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	769,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,1021,513,  1,769,769,  1,513,513,129,897,897,  1,897,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,577,577, 65,961,961,
+	193,961,961,  1,513,513,193,961,961,  1,961,961,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513, 33,801,545,  1,545,801,
+	  1,545,545, 33,993,993,225,993,993, 33,609,609,225,993,993, 97,
+	993,993,  1,513,513,  1,769,513,  1,513,769,  1,609,609, 97,993,
+	993,225,993,993,  1,513,513,225,993,993,  1,993,993,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,129,897,897,
+	  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,961,  1,513,
+	513,  1,769,513,  1,513,769,  1,529,529, 17,913,529,  1,785,785,
+	  1,513,513, 17,785,785,  1,529,913,  1,513,513, 17,785,529,  1,
+	529,785,  1,529,529, 17,1009,1009,241,1009,1009, 17,625,625,241,1009,
+	1009,113,1009,1009,  1,529,529, 17,817,561, 49,561,817, 49,625,625,
+	113,1009,1009,241,1009,1009, 17,561,561,241,1009,1009, 49,1009,1009,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513, 49,817,561,
+	  1,561,817,  1,561,561, 49,1009,1009,241,1009,1009, 49,625,625,241,
+	1009,1009,113,1009,1009,  1,513,513,  1,769,513,  1,513,769,  1,625,
+	625,113,1009,1009,241,1009,1009,  1,513,513,241,1009,1009,  1,1009,1009,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,
+	961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,769,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,993,513,  1,769,769,  1,513,
+	513,129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,577,577, 65,961,961,193,961,961,  1,513,513,193,961,961,  1,
+	961,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,769,769,  1,
+	513,513,129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,
+	  1,513,993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  9,777,521,  1,521,777,  1,521,521,  9,969,521,  1,777,777,
+	  1,513,513,137,905,905,  1,905,905,  1,513,513,  1,769,513,  1,
+	513,769,  1,521,521,  9,905,905,137,905,905,  1,513,513,  9,777,
+	777,  1,521,969,  1,513,513,  1,769,513,  1,513,769,  1,521,521,
+	  9,905,521,  1,777,777,  1,513,513,  9,777,777,  1,521,905,  1,
+	513,513,  9,777,521,  1,521,777,  1,521,521,  9,1017,1017,249,1017,
+	1017,  9,633,633,249,1017,1017,121,1017,1017,  1,521,521,  9,825,569,
+	 57,569,825, 57,633,633,121,1017,1017,249,1017,1017,  9,569,569,249,
+	1017,1017, 57,1017,1017,  1,513,513,  9,777,521,  1,521,777,  1,521,
+	521,  9,921,537, 25,793,793,  9,537,537,  9,793,793, 25,537,921,
+	  9,537,537, 57,825,569, 25,569,825, 25,569,569, 57,1017,1017,249,
+	1017,1017, 57,633,633,249,1017,1017,121,1017,1017,  1,521,521,  9,793,
+	537, 25,537,793, 25,633,633,121,1017,1017,249,1017,1017,  9,537,537,
+	249,1017,1017, 25,1017,1017,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,
+	  1,769,769,  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,
+	513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,
+	  1,537,537, 25,921,537,  1,793,793,  1,513,513, 25,793,793,  1,
+	537,921,  1,513,513, 25,793,537,  1,537,793,  1,537,537, 25,1017,
+	1017,249,1017,1017, 25,633,633,249,1017,1017,121,1017,1017,  1,537,537,
+	 25,825,569, 57,569,825, 57,633,633,121,1017,1017,249,1017,1017, 25,
+	569,569,249,1017,1017, 57,1017,1017,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513, 57,825,569,  1,569,825,  1,569,569, 57,
+	1017,1017,249,1017,1017, 57,633,633,249,1017,1017,121,1017,1017,  1,513,
+	513,  1,769,513,  1,513,769,  1,633,633,121,1017,1017,249,1017,1017,
+	  1,513,513,249,1017,1017,  1,1017,1017,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,961,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,993,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,897,129,
+	897,897,  1,513,513,  1,769,769,  1,513,961,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,769,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,993,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,769,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,1009,513,  1,513,769,  1,513,513,  1,769,769,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,897,129,897,897,  1,513,513,  1,769,769,  1,513,961,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,961,961,193,961,961,  1,577,577,193,961,
+	961, 65,961,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,513,993,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,
+	769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,513,961,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,993,993,225,993,993,  1,609,609,
+	225,993,993, 97,993,993,  1,513,513,  1,801,545, 33,545,801, 33,
+	609,609, 97,993,993,225,993,993,  1,545,545,225,993,993, 33,993,
+	993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,961,961,193,961,961,  1,577,
+	577,193,961,961, 65,961,961,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,
+	513,1009,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,
+	513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,993,513,  1,513,769,
+	  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,
+	769,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,961,193,961,
+	961,  1,577,577,193,961,961, 65,961,961,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,
+	769,769,  1,513,993,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,
+	513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,897,129,897,897,  1,513,513,
+	  1,769,769,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,769,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,1017,1017,
+	249,1017,1017,  1,633,633,249,1017,1017,121,1017,1017,  1,513,513,  1,
+	825,569, 57,569,825, 57,633,633,121,1017,1017,249,1017,1017,  1,569,
+	569,249,1017,1017, 57,1017,1017,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,921,537, 25,793,793,  1,537,537,  1,793,793, 25,
+	537,921,  1,537,537, 57,825,569, 25,569,825, 25,569,569, 57,1017,
+	1017,249,1017,1017, 57,633,633,249,1017,1017,121,1017,1017,  1,513,513,
+	  1,793,537, 25,537,793, 25,633,633,121,1017,1017,249,1017,1017,  1,
+	537,537,249,1017,1017, 25,1017,1017,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	969,521,  9,777,777,  1,521,521,137,905,905,  9,905,905,  1,513,
+	513,  1,777,521,  9,521,777,  1,513,513,  1,905,905,137,905,905,
+	  1,521,521,  1,777,777,  9,521,969,  1,513,513,  1,777,521,  9,
+	521,777,  9,537,537, 25,921,537,  9,793,793,  1,521,521, 25,793,
+	793,  9,537,921,  1,521,521, 25,793,537,  9,537,793,  9,537,537,
+	 25,1017,1017,249,1017,1017, 25,633,633,249,1017,1017,121,1017,1017,  9,
+	537,537, 25,825,569, 57,569,825, 57,633,633,121,1017,1017,249,1017,
+	1017, 25,569,569,249,1017,1017, 57,1017,1017,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,905,521,  9,777,777,  1,521,521,  1,
+	777,777,  9,521,905,  1,521,521, 57,825,569,  9,569,825,  9,569,
+	569, 57,1017,1017,249,1017,1017, 57,633,633,249,1017,1017,121,1017,1017,
+	  1,513,513,  1,777,521,  9,521,777,  9,633,633,121,1017,1017,249,
+	1017,1017,  1,521,521,249,1017,1017,  9,1017,1017,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,769,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,993,513,  1,513,769,  1,513,513,  1,769,769,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	897,129,897,897,  1,513,513,  1,769,769,  1,513,961,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,961,961,193,961,961,  1,577,577,193,961,961,
+	 65,961,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,897,129,897,897,  1,513,513,  1,769,769,  1,513,993,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,
+	769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,513,961,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,1009,1009,241,1009,1009,  1,625,625,241,
+	1009,1009,113,1009,1009,  1,513,513,  1,817,561, 49,561,817, 49,625,
+	625,113,1009,1009,241,1009,1009,  1,561,561,241,1009,1009, 49,1009,1009,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,913,529, 17,
+	785,785,  1,529,529,  1,785,785, 17,529,913,  1,529,529, 49,817,
+	561, 17,561,817, 17,561,561, 49,1009,1009,241,1009,1009, 49,625,625,
+	241,1009,1009,113,1009,1009,  1,513,513,  1,785,529, 17,529,785, 17,
+	625,625,113,1009,1009,241,1009,1009,  1,529,529,241,1009,1009, 17,1009,
+	1009,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,
+	513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,
+	513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,993,993,225,993,993,  1,
+	609,609,225,993,993, 97,993,993,  1,513,513,  1,801,545, 33,545,
+	801, 33,609,609, 97,993,993,225,993,993,  1,545,545,225,993,993,
+	 33,993,993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,961,961,193,961,961,
+	  1,577,577,193,961,961, 65,961,961,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,
+	769,  1,513,1021,  3,515,515,  3,771,515,  3,515,771,  3,515,515,
+	  3,899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,  3,
+	515,515,  3,771,515,  3,515,771,  3,515,515,  3,963,515,  3,515,
+	771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,
+	  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,
+	771,515,  3,515,963,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,
+	  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,995,515,  3,
+	515,771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,899,515,  3,771,771,  3,515,515,
+	  3,771,515,  3,515,963,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,
+	899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,963,515,
+	  3,515,771,  3,515,515,  3,771,771,  3,515,899,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,
+	515,  3,771,515,  3,515,995,  3,515,515,  3,771,515,  3,515,771,
+	  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,515,  3,
+	515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,963,
+	515,  3,515,771,  3,515,515,  3,771,771,  3,515,899,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,
+	515,515,  3,771,515,  3,515,963,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,515,
+	  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,
+	1011,515,  3,515,771,  3,515,515,  3,771,771,  3,515,899,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,899,899,131,899,899,
+	  3,515,515,  3,771,771,  3,515,963,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,
+	515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,
+	  3,963,963,195,963,963,  3,579,579,195,963,963, 67,963,963,  3,
+	515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,899,131,899,
+	899,  3,515,515,  3,771,771,  3,515,995,  3,515,515,  3,771,515,
+	  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,
+	771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,963,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,
+	  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,
+	771,771,  3,515,515,  3,771,515,  3,515,963,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,
+	  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,995,515,  3,771,771,  3,515,515,131,899,899,  3,899,
+	899,  3,515,515,  3,771,515,  3,515,771,  3,579,579, 67,963,963,
+	195,963,963,  3,515,515,195,963,963,  3,963,963,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,
+	515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,
+	  3,515,515,  3,963,515,  3,771,771,  3,515,515,131,899,899,  3,
+	899,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,
+	515,  3,771,771,  3,515,515,  3,771,515,  3,515,1011,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,
+	515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,963,515,  3,515,771,  3,515,515,  3,771,515,
+	  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,
+	899,515,  3,771,771,  3,515,515,  3,771,515,  3,515,963,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,771,771,
+	  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,995,515,  3,771,771,  3,515,515,131,899,
+	899,  3,899,899,  3,515,515,  3,771,515,  3,515,771,  3,579,579,
+	 67,963,963,195,963,963,  3,515,515,195,963,963,  3,963,963,  3,
+	515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,
+	771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,
+	  3,515,771,  3,515,515,  3,963,515,  3,771,771,  3,515,515,131,
+	899,899,  3,899,899,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,899,515,  3,771,771,  3,515,515,  3,771,515,  3,515,995,
+	  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,
+	515,771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,963,515,  3,771,771,  3,515,515,
+	131,899,899,  3,899,899,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,899,515,  3,771,771,  3,515,515,  3,771,515,  3,515,
+	963,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,
+	  3,771,771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,1019,515,  3,771,771,  3,515,
+	515,131,899,899,  3,899,899,  3,515,515,  3,771,515,  3,515,771,
+	  3,579,579, 67,963,963,195,963,963,  3,515,515,195,963,963,  3,
+	963,963,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,
+	515,  3,771,771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,
+	 35,803,547,  3,547,803,  3,547,547, 35,995,995,227,995,995, 35,
+	611,611,227,995,995, 99,995,995,  3,515,515,  3,771,515,  3,515,
+	771,  3,611,611, 99,995,995,227,995,995,  3,515,515,227,995,995,
+	  3,995,995,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,
+	899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,963,515,  3,771,771,
+	  3,515,515,131,899,899,  3,899,899,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,899,515,  3,771,771,  3,515,515,  3,771,
+	515,  3,515,963,  3,515,515,  3,771,515,  3,515,771,  3,531,531,
+	 19,915,531,  3,787,787,  3,515,515, 19,787,787,  3,531,915,  3,
+	515,515, 19,787,531,  3,531,787,  3,531,531, 19,1011,1011,243,1011,
+	1011, 19,627,627,243,1011,1011,115,1011,1011,  3,531,531, 19,819,563,
+	 51,563,819, 51,627,627,115,1011,1011,243,1011,1011, 19,563,563,243,
+	1011,1011, 51,1011,1011,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,899,515,  3,771,771,  3,515,515,  3,771,515,  3,515,899,
+	  3,515,515, 51,819,563,  3,563,819,  3,563,563, 51,1011,1011,243,
+	1011,1011, 51,627,627,243,1011,1011,115,1011,1011,  3,515,515,  3,771,
+	515,  3,515,771,  3,627,627,115,1011,1011,243,1011,1011,  3,515,515,
+	243,1011,1011,  3,1011,1011,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,
+	899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,963,515,
+	  3,515,771,  3,515,515,  3,771,771,  3,515,899,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,
+	515,  3,771,515,  3,515,963,  3,515,515,  3,771,515,  3,515,771,
+	  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,515,  3,
+	515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,995,
+	515,  3,515,771,  3,515,515,  3,771,771,  3,515,899,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,899,899,131,899,899,  3,
+	515,515,  3,771,771,  3,515,963,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,771,
+	  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,
+	963,963,195,963,963,  3,579,579,195,963,963, 67,963,963,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,899,899,131,899,899,
+	  3,515,515,  3,771,771,  3,515,995,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,
+	515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,
+	  3,963,515,  3,515,771,  3,515,515,  3,771,771,  3,515,899,  3,
+	515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,899,131,899,
+	899,  3,515,515,  3,771,771,  3,515,963,  3,515,515,  3,771,515,
+	  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,
+	771,771,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,1011,1011,243,1011,1011,  3,627,627,243,1011,1011,115,1011,1011,
+	  3,515,515,  3,819,563, 51,563,819, 51,627,627,115,1011,1011,243,
+	1011,1011,  3,563,563,243,1011,1011, 51,1011,1011,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,915,531, 19,787,787,  3,531,531,
+	  3,787,787, 19,531,915,  3,531,531, 51,819,563, 19,563,819, 19,
+	563,563, 51,1011,1011,243,1011,1011, 51,627,627,243,1011,1011,115,1011,
+	1011,  3,515,515,  3,787,531, 19,531,787, 19,627,627,115,1011,1011,
+	243,1011,1011,  3,531,531,243,1011,1011, 19,1011,1011,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,
+	515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,
+	  3,515,515,  3,963,515,  3,515,771,  3,515,515,  3,771,771,  3,
+	515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,
+	899,131,899,899,  3,515,515,  3,771,771,  3,515,963,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,
+	515,515,  3,771,771,  3,515,899,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,995,995,227,995,995,  3,611,611,227,995,995,
+	 99,995,995,  3,515,515,  3,803,547, 35,547,803, 35,611,611, 99,
+	995,995,227,995,995,  3,547,547,227,995,995, 35,995,995,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,
+	  3,515,515,  3,771,771,  3,515,899,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,963,963,195,963,963,  3,579,579,195,963,
+	963, 67,963,963,  3,515,515,  3,771,515,  3,515,771,  3,515,515,
+	  3,899,899,131,899,899,  3,515,515,  3,771,771,  3,515,1019,  7,
+	519,519,  7,775,519,  7,519,775,  7,519,519,  7,903,519,  7,519,
+	775,  7,519,519,  7,775,519,  7,519,903,  7,519,519,  7,775,519,
+	  7,519,775,  7,519,519,  7,967,519,  7,519,775,  7,519,519,  7,
+	775,519,  7,519,903,  7,519,519,  7,775,519,  7,519,775,  7,519,
+	519,  7,903,519,  7,519,775,  7,519,519,  7,775,519,  7,519,967,
+	  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,903,519,  7,
+	519,775,  7,519,519,  7,775,519,  7,519,903,  7,519,519,  7,775,
+	519,  7,519,775,  7,519,519,  7,999,519,  7,519,775,  7,519,519,
+	  7,775,775,  7,519,903,  7,519,519,  7,775,519,  7,519,775,  7,
+	519,519,  7,903,903,135,903,903,  7,519,519,  7,775,775,  7,519,
+	967,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,903,519,
+	  7,519,775,  7,519,519,  7,775,519,  7,519,903,  7,519,519,  7,
+	775,519,  7,519,775,  7,519,519,  7,967,519,  7,775,775,  7,519,
+	519,135,903,903,  7,903,903,  7,519,519,  7,775,519,  7,519,775,
+	  7,519,519,  7,903,519,  7,775,775,  7,519,519,  7,775,519,  7,
+	519,999,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,903,
+	519,  7,519,775,  7,519,519,  7,775,519,  7,519,903,  7,519,519,
+	  7,775,519,  7,519,775,  7,519,519,  7,967,519,  7,775,775,  7,
+	519,519,135,903,903,  7,903,903,  7,519,519,  7,775,519,  7,519,
+	775,  7,519,519,  7,903,519,  7,775,775,  7,519,519,  7,775,519,
+	  7,519,967,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,
+	903,519,  7,775,775,  7,519,519,  7,775,519,  7,519,903,  7,519,
+	519,  7,775,519,  7,519,775,  7,519,519,  7,1015,519,  7,775,775,
+	  7,519,519,135,903,903,  7,903,903,  7,519,519,  7,775,519,  7,
+	519,775,  7,583,583, 71,967,967,199,967,967,  7,519,519,199,967,
+	967,  7,967,967,  7,519,519,  7,775,519,  7,519,775,  7,519,519,
+	  7,903,519,  7,775,775,  7,519,519,  7,775,519,  7,519,903,  7,
+	519,519, 39,807,551,  7,551,807,  7,551,551, 39,999,999,231,999,
+	999, 39,615,615,231,999,999,103,999,999,  7,519,519,  7,775,519,
+	  7,519,775,  7,615,615,103,999,999,231,999,999,  7,519,519,231,
+	999,999,  7,999,999,  7,519,519,  7,775,519,  7,519,775,  7,519,
+	519,  7,903,519,  7,519,775,  7,519,519,  7,775,519,  7,519,903,
+	  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,967,519,  7,
+	519,775,  7,519,519,  7,775,775,  7,519,903,  7,519,519,  7,775,
+	519,  7,519,775,  7,519,519,  7,903,903,135,903,903,  7,519,519,
+	  7,775,775,  7,519,967,  7,519,519,  7,775,519,  7,519,775,  7,
+	519,519,  7,903,519,  7,519,775,  7,519,519,  7,775,775,  7,519,
+	903,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,999,999,
+	231,999,999,  7,615,615,231,999,999,103,999,999,  7,519,519,  7,
+	807,551, 39,551,807, 39,615,615,103,999,999,231,999,999,  7,551,
+	551,231,999,999, 39,999,999,  7,519,519,  7,775,519,  7,519,775,
+	  7,519,519,  7,903,519,  7,519,775,  7,519,519,  7,775,775,  7,
+	519,903,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,967,
+	967,199,967,967,  7,583,583,199,967,967, 71,967,967,  7,519,519,
+	  7,775,519,  7,519,775,  7,519,519,  7,903,903,135,903,903,  7,
+	519,519,  7,775,775,  7,519,1015, 15,527,527, 15,783,527, 15,527,
+	783, 15,527,527, 15,911,527, 15,527,783, 15,527,527, 15,783,527,
+	 15,527,911, 15,527,527, 15,783,527, 15,527,783, 15,527,527, 15,
+	975,527, 15,527,783, 15,527,527, 15,783,783, 15,527,911, 15,527,
+	527, 15,783,527, 15,527,783, 15,527,527, 15,911,527, 15,783,783,
+	 15,527,527, 15,783,527, 15,527,975, 15,527,527, 15,783,527, 15,
+	527,783, 15,527,527, 15,911,527, 15,783,783, 15,527,527, 15,783,
+	527, 15,527,911, 15,527,527, 15,783,527, 15,527,783, 15,527,527,
+	 15,1007,527, 15,783,783, 15,527,527,143,911,911, 15,911,911, 15,
+	527,527, 15,783,527, 15,527,783, 15,591,591, 79,975,975,207,975,
+	975, 15,527,527,207,975,975, 15,975,975, 15,527,527, 15,783,527,
+	 15,527,783, 15,527,527, 15,911,527, 15,527,783, 15,527,527, 15,
+	783,783, 15,527,911, 15,527,527, 15,783,527, 15,527,783, 15,527,
+	527, 15,975,975,207,975,975, 15,591,591,207,975,975, 79,975,975,
+	 15,527,527, 15,783,527, 15,527,783, 15,527,527, 15,911,911,143,
+	911,911, 15,527,527, 15,783,783, 15,527,1007, 31,543,543, 31,799,
+	543, 31,543,799, 31,543,543, 31,927,543, 31,543,799, 31,543,543,
+	 31,799,543, 31,543,927, 31,543,543, 31,799,543, 31,543,799, 31,
+	543,543, 31,991,543, 31,799,799, 31,543,543,159,927,927, 31,927,
+	927, 31,543,543, 31,799,543, 31,543,799, 31,543,543, 31,927,927,
+	159,927,927, 31,543,543, 31,799,799, 31,543,991, 63,575,575, 63,
+	831,575, 63,575,831, 63,575,575, 63,959,575, 63,831,831, 63,575,
+	575, 63,831,831, 63,575,959,127,639,639,127,895,639,127,639,895,
+	255,767,767,511,1023,1023,255,1023,1023,127,639,639,255,1023,1023,127,
+	1023,1023, 63,575,575, 63,831,575, 63,575,831, 63,639,639,127,1023,
+	1023,255,1023,1023, 63,575,575,255,1023,1023, 63,1023,1023, 31,543,543,
+	 31,799,543, 31,543,799, 31,543,543, 31,927,543, 31,799,799, 31,
+	543,543, 31,799,799, 31,543,927, 31,543,543, 63,831,575, 31,575,
+	831, 31,575,575, 63,1023,1023,255,1023,1023, 63,639,639,255,1023,1023,
+	127,1023,1023, 31,543,543, 31,799,543, 31,543,799, 31,639,639,127,
+	1023,1023,255,1023,1023, 31,543,543,255,1023,1023, 31,1023,1023, 15,527,
+	527, 15,783,527, 15,527,783, 15,527,527, 15,911,527, 15,527,783,
+	 15,527,527, 15,783,527, 15,527,911, 15,527,527, 15,783,527, 15,
+	527,783, 15,527,527, 15,975,527, 15,783,783, 15,527,527,143,911,
+	911, 15,911,911, 15,527,527, 15,783,527, 15,527,783, 15,527,527,
+	 15,911,911,143,911,911, 15,527,527, 15,783,783, 15,527,975, 15,
+	527,527, 15,783,527, 15,527,783, 15,543,543, 31,927,543, 15,799,
+	799, 15,527,527, 31,799,799, 15,543,927, 15,527,527, 31,799,543,
+	 15,543,799, 15,543,543, 31,1023,1023,255,1023,1023, 31,639,639,255,
+	1023,1023,127,1023,1023, 15,543,543, 31,831,575, 63,575,831, 63,639,
+	639,127,1023,1023,255,1023,1023, 31,575,575,255,1023,1023, 63,1023,1023,
+	 15,527,527, 15,783,527, 15,527,783, 15,527,527, 15,911,527, 15,
+	783,783, 15,527,527, 15,783,783, 15,527,911, 15,527,527, 63,831,
+	575, 15,575,831, 15,575,575, 63,1023,1023,255,1023,1023, 63,639,639,
+	255,1023,1023,127,1023,1023, 15,527,527, 15,783,527, 15,527,783, 15,
+	639,639,127,1023,1023,255,1023,1023, 15,527,527,255,1023,1023, 15,1023,
+	1023,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,903,519,
+	  7,519,775,  7,519,519,  7,775,519,  7,519,903,  7,519,519,  7,
+	775,519,  7,519,775,  7,519,519,  7,967,519,  7,519,775,  7,519,
+	519,  7,775,775,  7,519,903,  7,519,519,  7,775,519,  7,519,775,
+	  7,519,519,  7,903,519,  7,775,775,  7,519,519,  7,775,519,  7,
+	519,967,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,903,
+	519,  7,775,775,  7,519,519,  7,775,519,  7,519,903,  7,519,519,
+	  7,775,519,  7,519,775,  7,519,519,  7,999,519,  7,775,775,  7,
+	519,519,135,903,903,  7,903,903,  7,519,519,  7,775,519,  7,519,
+	775,  7,583,583, 71,967,967,199,967,967,  7,519,519,199,967,967,
+	  7,967,967,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,
+	903,519,  7,519,775,  7,519,519,  7,775,775,  7,519,903,  7,519,
+	519,  7,775,519,  7,519,775,  7,519,519,  7,967,967,199,967,967,
+	  7,583,583,199,967,967, 71,967,967,  7,519,519,  7,775,519,  7,
+	519,775,  7,519,519,  7,903,903,135,903,903,  7,519,519,  7,775,
+	775,  7,519,999,  7,519,519,  7,775,519,  7,519,775,  7,519,519,
+	  7,903,519,  7,519,775,  7,519,519,  7,775,519,  7,519,903,  7,
+	519,519, 15,783,527,  7,527,783,  7,527,527, 15,975,527,  7,783,
+	783,  7,519,519,143,911,911,  7,911,911,  7,519,519,  7,775,519,
+	  7,519,775,  7,527,527, 15,911,911,143,911,911,  7,519,519, 15,
+	783,783,  7,527,975,  7,519,519,  7,775,519,  7,519,775,  7,527,
+	527, 15,911,527,  7,783,783,  7,519,519, 15,783,783,  7,527,911,
+	  7,519,519, 15,783,527,  7,527,783,  7,527,527, 15,1023,1023,255,
+	1023,1023, 15,639,639,255,1023,1023,127,1023,1023,  7,527,527, 15,831,
+	575, 63,575,831, 63,639,639,127,1023,1023,255,1023,1023, 15,575,575,
+	255,1023,1023, 63,1023,1023,  7,519,519, 15,783,527,  7,527,783,  7,
+	527,527, 15,927,543, 31,799,799, 15,543,543, 15,799,799, 31,543,
+	927, 15,543,543, 63,831,575, 31,575,831, 31,575,575, 63,1023,1023,
+	255,1023,1023, 63,639,639,255,1023,1023,127,1023,1023,  7,527,527, 15,
+	799,543, 31,543,799, 31,639,639,127,1023,1023,255,1023,1023, 15,543,
+	543,255,1023,1023, 31,1023,1023,  7,519,519,  7,775,519,  7,519,775,
+	  7,519,519,  7,903,519,  7,519,775,  7,519,519,  7,775,519,  7,
+	519,903,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,967,
+	519,  7,775,775,  7,519,519,135,903,903,  7,903,903,  7,519,519,
+	  7,775,519,  7,519,775,  7,519,519,  7,903,903,135,903,903,  7,
+	519,519,  7,775,775,  7,519,967,  7,519,519,  7,775,519,  7,519,
+	775,  7,543,543, 31,927,543,  7,799,799,  7,519,519, 31,799,799,
+	  7,543,927,  7,519,519, 31,799,543,  7,543,799,  7,543,543, 31,
+	1023,1023,255,1023,1023, 31,639,639,255,1023,1023,127,1023,1023,  7,543,
+	543, 31,831,575, 63,575,831, 63,639,639,127,1023,1023,255,1023,1023,
+	 31,575,575,255,1023,1023, 63,1023,1023,  7,519,519,  7,775,519,  7,
+	519,775,  7,519,519,  7,903,519,  7,775,775,  7,519,519,  7,775,
+	775,  7,519,903,  7,519,519, 63,831,575,  7,575,831,  7,575,575,
+	 63,1023,1023,255,1023,1023, 63,639,639,255,1023,1023,127,1023,1023,  7,
+	519,519,  7,775,519,  7,519,775,  7,639,639,127,1023,1023,255,1023,
+	1023,  7,519,519,255,1023,1023,  7,1023,1023,  3,515,515,  3,771,515,
+	  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,
+	771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,963,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,
+	  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,
+	515,771,  3,515,515,  3,771,515,  3,515,963,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,
+	  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,995,515,  3,515,771,  3,515,515,  3,771,771,  3,515,
+	899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,899,
+	131,899,899,  3,515,515,  3,771,771,  3,515,963,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,
+	515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,
+	  3,515,515,  3,963,515,  3,771,771,  3,515,515,131,899,899,  3,
+	899,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,
+	515,  3,771,771,  3,515,515,  3,771,515,  3,515,995,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,
+	515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,963,515,  3,771,771,  3,515,515,131,899,899,
+	  3,899,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,
+	899,515,  3,771,771,  3,515,515,  3,771,515,  3,515,963,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,771,771,
+	  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,1011,515,  3,771,771,  3,515,515,131,899,
+	899,  3,899,899,  3,515,515,  3,771,515,  3,515,771,  3,579,579,
+	 67,963,963,195,963,963,  3,515,515,195,963,963,  3,963,963,  3,
+	515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,771,
+	771,  3,515,515,  3,771,515,  3,515,899,  3,515,515, 35,803,547,
+	  3,547,803,  3,547,547, 35,995,995,227,995,995, 35,611,611,227,
+	995,995, 99,995,995,  3,515,515,  3,771,515,  3,515,771,  3,611,
+	611, 99,995,995,227,995,995,  3,515,515,227,995,995,  3,995,995,
+	  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,
+	515,771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,963,515,  3,515,771,  3,515,515,
+	  3,771,771,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,899,899,131,899,899,  3,515,515,  3,771,771,  3,515,
+	963,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,
+	  3,515,771,  3,515,515,  3,771,771,  3,515,899,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,995,995,227,995,995,  3,611,
+	611,227,995,995, 99,995,995,  3,515,515,  3,803,547, 35,547,803,
+	 35,611,611, 99,995,995,227,995,995,  3,547,547,227,995,995, 35,
+	995,995,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,
+	515,  3,515,771,  3,515,515,  3,771,771,  3,515,899,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,963,963,195,963,963,  3,
+	579,579,195,963,963, 67,963,963,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,899,899,131,899,899,  3,515,515,  3,771,771,
+	  3,515,1011,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,
+	899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,963,515,  3,515,771,
+	  3,515,515,  3,771,771,  3,515,899,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,899,515,  3,771,771,  3,515,515,  3,771,
+	515,  3,515,963,  3,515,515,  3,771,515,  3,515,771,  3,519,519,
+	  7,903,519,  3,775,775,  3,515,515,  7,775,519,  3,519,903,  3,
+	515,515,  7,775,519,  3,519,775,  3,519,519,  7,999,519,  3,775,
+	775,  3,515,515,135,903,903,  3,903,903,  3,515,515,  3,771,515,
+	  3,515,771,  3,583,583, 71,967,967,199,967,967,  3,515,515,199,
+	967,967,  3,967,967,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,899,515,  3,515,771,  3,515,515,  3,771,771,  3,515,899,
+	  3,515,515,  7,775,519,  3,519,775,  3,519,519,  7,967,967,199,
+	967,967,  7,583,583,199,967,967, 71,967,967,  3,515,515,  3,771,
+	515,  3,515,771,  3,519,519,  7,903,903,135,903,903,  3,515,515,
+	  7,775,775,  3,519,999,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,
+	899,  3,515,515,  7,775,519,  3,519,775,  3,519,519,  7,967,519,
+	  3,775,775,  3,515,515,135,903,903,  3,903,903,  3,515,515,  3,
+	771,515,  3,515,771,  3,519,519,  7,903,903,135,903,903,  3,515,
+	515,  7,775,775,  3,519,967,  3,515,515,  3,771,515,  3,515,771,
+	  3,519,519,  7,903,519,  3,775,775,  3,515,515,  7,775,775,  3,
+	519,903,  3,515,515,  7,775,519,  3,519,775,  3,519,519,  7,1023,
+	1023,255,1023,1023,  7,639,639,255,1023,1023,127,1023,1023,  3,519,519,
+	  7,831,575, 63,575,831, 63,639,639,127,1023,1023,255,1023,1023,  7,
+	575,575,255,1023,1023, 63,1023,1023,  3,515,515,  7,775,519,  3,519,
+	775,  3,519,519,  7,927,543, 31,799,799,  7,543,543,  7,799,799,
+	 31,543,927,  7,543,543, 63,831,575, 31,575,831, 31,575,575, 63,
+	1023,1023,255,1023,1023, 63,639,639,255,1023,1023,127,1023,1023,  3,519,
+	519,  7,799,543, 31,543,799, 31,639,639,127,1023,1023,255,1023,1023,
+	  7,543,543,255,1023,1023, 31,1023,1023,  3,515,515,  3,771,515,  3,
+	515,771,  3,519,519,  7,903,519,  3,519,775,  3,515,515,  7,775,
+	519,  3,519,903,  3,515,515,  7,775,519,  3,519,775,  3,519,519,
+	  7,975,527, 15,783,783,  7,527,527,143,911,911, 15,911,911,  3,
+	519,519,  7,783,527, 15,527,783,  3,519,519,  7,911,911,143,911,
+	911,  7,527,527,  7,783,783, 15,527,975,  3,519,519,  7,783,527,
+	 15,527,783, 15,543,543, 31,927,543, 15,799,799,  7,527,527, 31,
+	799,799, 15,543,927,  7,527,527, 31,799,543, 15,543,799, 15,543,
+	543, 31,1023,1023,255,1023,1023, 31,639,639,255,1023,1023,127,1023,1023,
+	 15,543,543, 31,831,575, 63,575,831, 63,639,639,127,1023,1023,255,
+	1023,1023, 31,575,575,255,1023,1023, 63,1023,1023,  3,515,515,  7,775,
+	519,  3,519,775,  3,519,519,  7,911,527, 15,783,783,  7,527,527,
+	  7,783,783, 15,527,911,  7,527,527, 63,831,575, 15,575,831, 15,
+	575,575, 63,1023,1023,255,1023,1023, 63,639,639,255,1023,1023,127,1023,
+	1023,  3,519,519,  7,783,527, 15,527,783, 15,639,639,127,1023,1023,
+	255,1023,1023,  7,527,527,255,1023,1023, 15,1023,1023,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,
+	515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,
+	  3,515,515,  3,963,515,  3,515,771,  3,515,515,  3,771,771,  3,
+	515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,
+	515,  3,771,771,  3,515,515,  3,771,515,  3,515,963,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,771,771,  3,
+	515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,995,515,  3,771,771,  3,515,515,131,899,899,
+	  3,899,899,  3,515,515,  3,771,515,  3,515,771,  3,579,579, 67,
+	963,963,195,963,963,  3,515,515,195,963,963,  3,963,963,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,
+	  3,515,515,  3,771,771,  3,515,899,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,963,963,195,963,963,  3,579,579,195,963,
+	963, 67,963,963,  3,515,515,  3,771,515,  3,515,771,  3,515,515,
+	  3,899,899,131,899,899,  3,515,515,  3,771,771,  3,515,995,  3,
+	515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,
+	771,  3,515,515,  3,771,515,  3,515,899,  3,515,515, 15,783,527,
+	  3,527,783,  3,527,527, 15,975,527,  3,783,783,  3,515,515,143,
+	911,911,  3,911,911,  3,515,515,  3,771,515,  3,515,771,  3,527,
+	527, 15,911,911,143,911,911,  3,515,515, 15,783,783,  3,527,975,
+	  3,515,515,  3,771,515,  3,515,771,  3,527,527, 15,911,527,  3,
+	783,783,  3,515,515, 15,783,783,  3,527,911,  3,515,515, 15,783,
+	527,  3,527,783,  3,527,527, 15,1023,1023,255,1023,1023, 15,639,639,
+	255,1023,1023,127,1023,1023,  3,527,527, 15,831,575, 63,575,831, 63,
+	639,639,127,1023,1023,255,1023,1023, 15,575,575,255,1023,1023, 63,1023,
+	1023,  3,515,515, 15,783,527,  3,527,783,  3,527,527, 15,927,543,
+	 31,799,799, 15,543,543, 15,799,799, 31,543,927, 15,543,543, 63,
+	831,575, 31,575,831, 31,575,575, 63,1023,1023,255,1023,1023, 63,639,
+	639,255,1023,1023,127,1023,1023,  3,527,527, 15,799,543, 31,543,799,
+	 31,639,639,127,1023,1023,255,1023,1023, 15,543,543,255,1023,1023, 31,
+	1023,1023,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,
+	515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,963,515,  3,771,771,  3,
+	515,515,131,899,899,  3,899,899,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,899,899,131,899,899,  3,515,515,  3,771,771,
+	  3,515,963,  3,515,515,  3,771,515,  3,515,771,  3,543,543, 31,
+	927,543,  3,799,799,  3,515,515, 31,799,799,  3,543,927,  3,515,
+	515, 31,799,543,  3,543,799,  3,543,543, 31,1023,1023,255,1023,1023,
+	 31,639,639,255,1023,1023,127,1023,1023,  3,543,543, 31,831,575, 63,
+	575,831, 63,639,639,127,1023,1023,255,1023,1023, 31,575,575,255,1023,
+	1023, 63,1023,1023,  3,515,515,  3,771,515,  3,515,771,  3,515,515,
+	  3,899,515,  3,771,771,  3,515,515,  3,771,771,  3,515,899,  3,
+	515,515, 63,831,575,  3,575,831,  3,575,575, 63,1023,1023,255,1023,
+	1023, 63,639,639,255,1023,1023,127,1023,1023,  3,515,515,  3,771,515,
+	  3,515,771,  3,639,639,127,1023,1023,255,1023,1023,  3,515,515,255,
+	1023,1023,  3,1023,1023,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,993,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,
+	513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,
+	513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,993,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	961,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,1009,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,897,129,897,
+	897,  1,513,513,  1,769,769,  1,513,961,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,961,961,193,961,961,  1,577,577,193,961,961, 65,961,961,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,897,129,
+	897,897,  1,513,513,  1,769,769,  1,513,993,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,769,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,993,513,  1,769,769,  1,513,513,129,897,897,  1,
+	897,897,  1,513,513,  1,769,513,  1,513,769,  1,577,577, 65,961,
+	961,193,961,961,  1,513,513,193,961,961,  1,961,961,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,129,897,897,
+	  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,1009,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,961,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,993,513,  1,769,769,  1,513,513,129,
+	897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,577,
+	577, 65,961,961,193,961,961,  1,513,513,193,961,961,  1,961,961,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,
+	129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,
+	993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,961,513,  1,769,769,  1,513,
+	513,129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,
+	513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,769,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,1017,513,  1,769,769,  1,
+	513,513,129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,577,577, 65,961,961,193,961,961,  1,513,513,193,961,961,
+	  1,961,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513, 33,801,545,  1,545,801,  1,545,545, 33,993,993,225,993,993,
+	 33,609,609,225,993,993, 97,993,993,  1,513,513,  1,769,513,  1,
+	513,769,  1,609,609, 97,993,993,225,993,993,  1,513,513,225,993,
+	993,  1,993,993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,769,
+	769,  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,
+	769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,529,
+	529, 17,913,529,  1,785,785,  1,513,513, 17,785,785,  1,529,913,
+	  1,513,513, 17,785,529,  1,529,785,  1,529,529, 17,1009,1009,241,
+	1009,1009, 17,625,625,241,1009,1009,113,1009,1009,  1,529,529, 17,817,
+	561, 49,561,817, 49,625,625,113,1009,1009,241,1009,1009, 17,561,561,
+	241,1009,1009, 49,1009,1009,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513, 49,817,561,  1,561,817,  1,561,561, 49,1009,1009,
+	241,1009,1009, 49,625,625,241,1009,1009,113,1009,1009,  1,513,513,  1,
+	769,513,  1,513,769,  1,625,625,113,1009,1009,241,1009,1009,  1,513,
+	513,241,1009,1009,  1,1009,1009,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,
+	513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	993,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,897,129,897,897,
+	  1,513,513,  1,769,769,  1,513,961,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,961,961,193,961,961,  1,577,577,193,961,961, 65,961,961,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,897,129,897,
+	897,  1,513,513,  1,769,769,  1,513,993,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,961,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,897,129,
+	897,897,  1,513,513,  1,769,769,  1,513,961,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,1009,1009,241,1009,1009,  1,625,625,241,1009,1009,113,1009,
+	1009,  1,513,513,  1,817,561, 49,561,817, 49,625,625,113,1009,1009,
+	241,1009,1009,  1,561,561,241,1009,1009, 49,1009,1009,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,913,529, 17,785,785,  1,529,
+	529,  1,785,785, 17,529,913,  1,529,529, 49,817,561, 17,561,817,
+	 17,561,561, 49,1009,1009,241,1009,1009, 49,625,625,241,1009,1009,113,
+	1009,1009,  1,513,513,  1,785,529, 17,529,785, 17,625,625,113,1009,
+	1009,241,1009,1009,  1,529,529,241,1009,1009, 17,1009,1009,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,769,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,897,129,897,897,  1,513,513,  1,769,769,  1,513,961,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,993,993,225,993,993,  1,609,609,225,993,
+	993, 97,993,993,  1,513,513,  1,801,545, 33,545,801, 33,609,609,
+	 97,993,993,225,993,993,  1,545,545,225,993,993, 33,993,993,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,961,961,193,961,961,  1,577,577,193,
+	961,961, 65,961,961,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,513,1017,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,993,513,  1,513,769,  1,513,
+	513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,
+	513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,769,769,  1,
+	513,513,129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,
+	  1,513,993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  3,771,515,  1,515,771,  1,515,515,  3,963,515,  1,771,771,
+	  1,513,513,131,899,899,  1,899,899,  1,513,513,  1,769,513,  1,
+	513,769,  1,515,515,  3,899,515,  1,771,771,  1,513,513,  3,771,
+	515,  1,515,963,  1,513,513,  1,769,513,  1,513,769,  1,515,515,
+	  3,899,515,  1,771,771,  1,513,513,  3,771,515,  1,515,899,  1,
+	513,513,  3,771,515,  1,515,771,  1,515,515,  3,1011,515,  1,771,
+	771,  1,513,513,131,899,899,  1,899,899,  1,513,513,  1,769,513,
+	  1,513,769,  1,579,579, 67,963,963,195,963,963,  1,513,513,195,
+	963,963,  1,963,963,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513, 35,803,547,  1,547,803,  1,547,547, 35,995,995,227,
+	995,995, 35,611,611,227,995,995, 99,995,995,  1,513,513,  1,769,
+	513,  1,513,769,  1,611,611, 99,995,995,227,995,995,  1,513,513,
+	227,995,995,  1,995,995,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,
+	  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,897,129,897,897,  1,513,
+	513,  1,769,769,  1,513,961,  1,513,513,  1,769,513,  1,513,769,
+	  1,515,515,  3,899,515,  1,515,771,  1,513,513,  3,771,771,  1,
+	515,899,  1,513,513,  3,771,515,  1,515,771,  1,515,515,  3,995,
+	995,227,995,995,  3,611,611,227,995,995, 99,995,995,  1,515,515,
+	  3,803,547, 35,547,803, 35,611,611, 99,995,995,227,995,995,  3,
+	547,547,227,995,995, 35,995,995,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,769,
+	  1,513,897,  1,513,513,  3,771,515,  1,515,771,  1,515,515,  3,
+	963,963,195,963,963,  3,579,579,195,963,963, 67,963,963,  1,513,
+	513,  1,769,513,  1,513,769,  1,515,515,  3,899,899,131,899,899,
+	  1,513,513,  3,771,771,  1,515,1011,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,961,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,
+	769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,
+	  1,513,769,  1,515,515,  3,899,515,  1,771,771,  1,513,513,  3,
+	771,515,  1,515,899,  1,513,513,  3,771,515,  1,515,771,  1,515,
+	515,  3,995,515,  1,771,771,  1,513,513,131,899,899,  1,899,899,
+	  1,513,513,  1,769,513,  1,513,769,  1,579,579, 67,963,963,195,
+	963,963,  1,513,513,195,963,963,  1,963,963,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,769,  1,513,897,  1,513,513,  3,771,515,  1,515,771,  1,
+	515,515,  3,963,963,195,963,963,  3,579,579,195,963,963, 67,963,
+	963,  1,513,513,  1,769,513,  1,513,769,  1,515,515,  3,899,899,
+	131,899,899,  1,513,513,  3,771,771,  1,515,995,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  3,771,515,  1,515,771,
+	  1,515,515,  3,963,515,  1,771,771,  1,513,513,131,899,899,  1,
+	899,899,  1,513,513,  1,769,513,  1,513,769,  1,515,515,  3,899,
+	899,131,899,899,  1,513,513,  3,771,771,  1,515,963,  1,513,513,
+	  1,769,513,  1,513,769,  1,515,515,  3,899,515,  1,771,771,  1,
+	513,513,  3,771,771,  1,515,899,  1,513,513,  3,771,515,  1,515,
+	771,  1,515,515,  3,1023,1023,255,1023,1023,  3,639,639,255,1023,1023,
+	127,1023,1023,  1,515,515,  3,831,575, 63,575,831, 63,639,639,127,
+	1023,1023,255,1023,1023,  3,575,575,255,1023,1023, 63,1023,1023,  1,513,
+	513,  3,771,515,  1,515,771,  1,515,515,  3,927,543, 31,799,799,
+	  3,543,543,  3,799,799, 31,543,927,  3,543,543, 63,831,575, 31,
+	575,831, 31,575,575, 63,1023,1023,255,1023,1023, 63,639,639,255,1023,
+	1023,127,1023,1023,  1,515,515,  3,799,543, 31,543,799, 31,639,639,
+	127,1023,1023,255,1023,1023,  3,543,543,255,1023,1023, 31,1023,1023,  1,
+	513,513,  1,769,513,  1,513,769,  1,515,515,  3,899,515,  1,515,
+	771,  1,513,513,  3,771,515,  1,515,899,  1,513,513,  3,771,515,
+	  1,515,771,  1,515,515,  3,975,527, 15,783,783,  3,527,527,143,
+	911,911, 15,911,911,  1,515,515,  3,783,527, 15,527,783,  1,515,
+	515,  3,911,911,143,911,911,  3,527,527,  3,783,783, 15,527,975,
+	  1,515,515,  3,783,527, 15,527,783, 15,543,543, 31,927,543, 15,
+	799,799,  3,527,527, 31,799,799, 15,543,927,  3,527,527, 31,799,
+	543, 15,543,799, 15,543,543, 31,1023,1023,255,1023,1023, 31,639,639,
+	255,1023,1023,127,1023,1023, 15,543,543, 31,831,575, 63,575,831, 63,
+	639,639,127,1023,1023,255,1023,1023, 31,575,575,255,1023,1023, 63,1023,
+	1023,  1,513,513,  3,771,515,  1,515,771,  1,515,515,  3,911,527,
+	 15,783,783,  3,527,527,  3,783,783, 15,527,911,  3,527,527, 63,
+	831,575, 15,575,831, 15,575,575, 63,1023,1023,255,1023,1023, 63,639,
+	639,255,1023,1023,127,1023,1023,  1,515,515,  3,783,527, 15,527,783,
+	 15,639,639,127,1023,1023,255,1023,1023,  3,527,527,255,1023,1023, 15,
+	1023,1023,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  3,771,515,  1,515,771,  1,515,515,  3,963,515,  1,515,771,  1,
+	513,513,  3,771,771,  1,515,899,  1,513,513,  1,769,513,  1,513,
+	769,  1,515,515,  3,899,515,  3,771,771,  1,513,513,  3,771,515,
+	  1,515,963,  1,513,513,  1,769,513,  1,513,769,  1,515,515,  3,
+	899,515,  1,771,771,  1,513,513,  3,771,515,  1,515,899,  1,513,
+	513,  3,771,515,  1,515,771,  1,515,515,  3,999,519,  7,775,775,
+	  3,519,519,135,903,903,  7,903,903,  1,515,515,  3,775,519,  7,
+	519,775,  7,583,583, 71,967,967,199,967,967,  3,519,519,199,967,
+	967,  7,967,967,  1,513,513,  3,771,515,  1,515,771,  1,515,515,
+	  3,903,519,  7,519,775,  3,519,519,  3,775,775,  7,519,903,  1,
+	513,513,  3,771,515,  1,515,771,  1,515,515,  3,967,967,199,967,
+	967,  3,583,583,199,967,967, 71,967,967,  1,515,515,  3,775,519,
+	  7,519,775,  1,515,515,  3,903,903,135,903,903,  3,519,519,  3,
+	775,775,  7,519,999,  1,513,513,  3,771,515,  1,515,771,  1,515,
+	515,  3,903,519,  7,519,775,  3,519,519,  3,775,519,  7,519,903,
+	  3,519,519, 15,783,527,  7,527,783,  7,527,527, 15,975,527,  7,
+	783,783,  3,519,519,143,911,911,  7,911,911,  1,515,515,  3,775,
+	519,  7,519,775,  7,527,527, 15,911,911,143,911,911,  3,519,519,
+	 15,783,783,  7,527,975,  1,515,515,  3,775,519,  7,519,775,  7,
+	527,527, 15,911,527,  7,783,783,  3,519,519, 15,783,783,  7,527,
+	911,  3,519,519, 15,783,527,  7,527,783,  7,527,527, 15,1023,1023,
+	255,1023,1023, 15,639,639,255,1023,1023,127,1023,1023,  7,527,527, 15,
+	831,575, 63,575,831, 63,639,639,127,1023,1023,255,1023,1023, 15,575,
+	575,255,1023,1023, 63,1023,1023,  3,519,519, 15,783,527,  7,527,783,
+	  7,527,527, 15,927,543, 31,799,799, 15,543,543, 15,799,799, 31,
+	543,927, 15,543,543, 63,831,575, 31,575,831, 31,575,575, 63,1023,
+	1023,255,1023,1023, 63,639,639,255,1023,1023,127,1023,1023,  7,527,527,
+	 15,799,543, 31,543,799, 31,639,639,127,1023,1023,255,1023,1023, 15,
+	543,543,255,1023,1023, 31,1023,1023,  1,513,513,  1,769,513,  1,513,
+	769,  1,515,515,  3,899,515,  1,515,771,  1,513,513,  3,771,515,
+	  1,515,899,  1,513,513,  3,771,515,  1,515,771,  1,515,515,  3,
+	967,519,  7,775,775,  3,519,519,135,903,903,  7,903,903,  1,515,
+	515,  3,775,519,  7,519,775,  1,515,515,  3,903,903,135,903,903,
+	  3,519,519,  3,775,775,  7,519,967,  1,515,515,  3,775,519,  7,
+	519,775,  7,543,543, 31,927,543,  7,799,799,  3,519,519, 31,799,
+	799,  7,543,927,  3,519,519, 31,799,543,  7,543,799,  7,543,543,
+	 31,1023,1023,255,1023,1023, 31,639,639,255,1023,1023,127,1023,1023,  7,
+	543,543, 31,831,575, 63,575,831, 63,639,639,127,1023,1023,255,1023,
+	1023, 31,575,575,255,1023,1023, 63,1023,1023,  1,513,513,  3,771,515,
+	  1,515,771,  1,515,515,  3,903,519,  7,775,775,  3,519,519,  3,
+	775,775,  7,519,903,  3,519,519, 63,831,575,  7,575,831,  7,575,
+	575, 63,1023,1023,255,1023,1023, 63,639,639,255,1023,1023,127,1023,1023,
+	  1,515,515,  3,775,519,  7,519,775,  7,639,639,127,1023,1023,255,
+	1023,1023,  3,519,519,255,1023,1023,  7,1023,1023,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,993,513,  1,513,769,  1,513,513,  1,769,769,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	897,129,897,897,  1,513,513,  1,769,769,  1,513,961,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,129,897,897,
+	  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,993,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,129,897,
+	897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,961,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,1009,513,  1,769,769,  1,513,513,129,
+	897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,577,
+	577, 65,961,961,193,961,961,  1,513,513,193,961,961,  1,961,961,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	769,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513, 33,801,
+	545,  1,545,801,  1,545,545, 33,993,993,225,993,993, 33,609,609,
+	225,993,993, 97,993,993,  1,513,513,  1,769,513,  1,513,769,  1,
+	609,609, 97,993,993,225,993,993,  1,513,513,225,993,993,  1,993,
+	993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,
+	513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,
+	513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,993,993,225,993,993,  1,
+	609,609,225,993,993, 97,993,993,  1,513,513,  1,801,545, 33,545,
+	801, 33,609,609, 97,993,993,225,993,993,  1,545,545,225,993,993,
+	 33,993,993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,961,961,193,961,961,
+	  1,577,577,193,961,961, 65,961,961,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,
+	769,  1,513,1009,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,
+	769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,
+	769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,519,
+	519,  7,903,519,  1,775,775,  1,513,513,  7,775,519,  1,519,903,
+	  1,513,513,  7,775,519,  1,519,775,  1,519,519,  7,999,519,  1,
+	775,775,  1,513,513,135,903,903,  1,903,903,  1,513,513,  1,769,
+	513,  1,513,769,  1,583,583, 71,967,967,199,967,967,  1,513,513,
+	199,967,967,  1,967,967,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,769,  1,513,
+	897,  1,513,513,  7,775,519,  1,519,775,  1,519,519,  7,967,967,
+	199,967,967,  7,583,583,199,967,967, 71,967,967,  1,513,513,  1,
+	769,513,  1,513,769,  1,519,519,  7,903,903,135,903,903,  1,513,
+	513,  7,775,775,  1,519,999,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513,  7,775,519,  1,519,775,  1,519,519,  7,967,
+	519,  1,775,775,  1,513,513,135,903,903,  1,903,903,  1,513,513,
+	  1,769,513,  1,513,769,  1,519,519,  7,903,903,135,903,903,  1,
+	513,513,  7,775,775,  1,519,967,  1,513,513,  1,769,513,  1,513,
+	769,  1,519,519,  7,903,519,  1,775,775,  1,513,513,  7,775,775,
+	  1,519,903,  1,513,513,  7,775,519,  1,519,775,  1,519,519,  7,
+	1023,1023,255,1023,1023,  7,639,639,255,1023,1023,127,1023,1023,  1,519,
+	519,  7,831,575, 63,575,831, 63,639,639,127,1023,1023,255,1023,1023,
+	  7,575,575,255,1023,1023, 63,1023,1023,  1,513,513,  7,775,519,  1,
+	519,775,  1,519,519,  7,927,543, 31,799,799,  7,543,543,  7,799,
+	799, 31,543,927,  7,543,543, 63,831,575, 31,575,831, 31,575,575,
+	 63,1023,1023,255,1023,1023, 63,639,639,255,1023,1023,127,1023,1023,  1,
+	519,519,  7,799,543, 31,543,799, 31,639,639,127,1023,1023,255,1023,
+	1023,  7,543,543,255,1023,1023, 31,1023,1023,  1,513,513,  1,769,513,
+	  1,513,769,  1,519,519,  7,903,519,  1,519,775,  1,513,513,  7,
+	775,519,  1,519,903,  1,513,513,  7,775,519,  1,519,775,  1,519,
+	519,  7,975,527, 15,783,783,  7,527,527,143,911,911, 15,911,911,
+	  1,519,519,  7,783,527, 15,527,783,  1,519,519,  7,911,911,143,
+	911,911,  7,527,527,  7,783,783, 15,527,975,  1,519,519,  7,783,
+	527, 15,527,783, 15,543,543, 31,927,543, 15,799,799,  7,527,527,
+	 31,799,799, 15,543,927,  7,527,527, 31,799,543, 15,543,799, 15,
+	543,543, 31,1023,1023,255,1023,1023, 31,639,639,255,1023,1023,127,1023,
+	1023, 15,543,543, 31,831,575, 63,575,831, 63,639,639,127,1023,1023,
+	255,1023,1023, 31,575,575,255,1023,1023, 63,1023,1023,  1,513,513,  7,
+	775,519,  1,519,775,  1,519,519,  7,911,527, 15,783,783,  7,527,
+	527,  7,783,783, 15,527,911,  7,527,527, 63,831,575, 15,575,831,
+	 15,575,575, 63,1023,1023,255,1023,1023, 63,639,639,255,1023,1023,127,
+	1023,1023,  1,519,519,  7,783,527, 15,527,783, 15,639,639,127,1023,
+	1023,255,1023,1023,  7,527,527,255,1023,1023, 15,1023,1023,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,769,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,961,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,993,513,  1,769,769,  1,513,513,129,897,
+	897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,577,577,
+	 65,961,961,193,961,961,  1,513,513,193,961,961,  1,961,961,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,961,961,193,961,961,  1,577,577,193,
+	961,961, 65,961,961,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,513,993,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513, 15,783,
+	527,  1,527,783,  1,527,527, 15,975,527,  1,783,783,  1,513,513,
+	143,911,911,  1,911,911,  1,513,513,  1,769,513,  1,513,769,  1,
+	527,527, 15,911,911,143,911,911,  1,513,513, 15,783,783,  1,527,
+	975,  1,513,513,  1,769,513,  1,513,769,  1,527,527, 15,911,527,
+	  1,783,783,  1,513,513, 15,783,783,  1,527,911,  1,513,513, 15,
+	783,527,  1,527,783,  1,527,527, 15,1023,1023,255,1023,1023, 15,639,
+	639,255,1023,1023,127,1023,1023,  1,527,527, 15,831,575, 63,575,831,
+	 63,639,639,127,1023,1023,255,1023,1023, 15,575,575,255,1023,1023, 63,
+	1023,1023,  1,513,513, 15,783,527,  1,527,783,  1,527,527, 15,927,
+	543, 31,799,799, 15,543,543, 15,799,799, 31,543,927, 15,543,543,
+	 63,831,575, 31,575,831, 31,575,575, 63,1023,1023,255,1023,1023, 63,
+	639,639,255,1023,1023,127,1023,1023,  1,527,527, 15,799,543, 31,543,
+	799, 31,639,639,127,1023,1023,255,1023,1023, 15,543,543,255,1023,1023,
+	 31,1023,1023,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,769,769,
+	  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,
+	769,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,543,543,
+	 31,927,543,  1,799,799,  1,513,513, 31,799,799,  1,543,927,  1,
+	513,513, 31,799,543,  1,543,799,  1,543,543, 31,1023,1023,255,1023,
+	1023, 31,639,639,255,1023,1023,127,1023,1023,  1,543,543, 31,831,575,
+	 63,575,831, 63,639,639,127,1023,1023,255,1023,1023, 31,575,575,255,
+	1023,1023, 63,1023,1023,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,769,769,  1,513,513,  1,769,769,  1,513,897,
+	  1,513,513, 63,831,575,  1,575,831,  1,575,575, 63,1023,1023,255,
+	1023,1023, 63,639,639,255,1023,1023,127,1023,1023,  1,513,513,  1,769,
+	513,  1,513,769,  1,639,639,127,1023,1023,255,1023,1023,  1,513,513,
+	255,1023,1023,  1,1023,1023,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,993,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	961,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,993,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,961,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,1009,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	769,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,961,513,  1,769,769,  1,513,513,129,897,897,  1,897,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,769,769,  1,513,513,  1,769,513,  1,513,993,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,993,513,  1,513,769,  1,513,513,  1,769,769,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,897,129,897,897,  1,513,513,  1,769,769,  1,513,961,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,
+	769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,1009,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,961,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,993,513,  1,513,769,  1,513,513,
+	  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,513,
+	961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,
+	513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,
+	513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,1017,513,  1,513,769,
+	  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,
+	769,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,961,193,961,
+	961,  1,577,577,193,961,961, 65,961,961,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,
+	769,769,  1,513,993,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,
+	513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,769,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,993,993,
+	225,993,993,  1,609,609,225,993,993, 97,993,993,  1,513,513,  1,
+	801,545, 33,545,801, 33,609,609, 97,993,993,225,993,993,  1,545,
+	545,225,993,993, 33,993,993,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,
+	961,193,961,961,  1,577,577,193,961,961, 65,961,961,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,897,129,897,897,  1,
+	513,513,  1,769,769,  1,513,1009,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	961,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,993,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,
+	769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,961,513,  1,769,769,  1,513,513,129,897,897,  1,897,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	769,769,  1,513,513,  1,769,513,  1,513,993,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,769,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,1009,513,  1,769,769,  1,513,513,129,897,897,  1,
+	897,897,  1,513,513,  1,769,513,  1,513,769,  1,577,577, 65,961,
+	961,193,961,961,  1,513,513,193,961,961,  1,961,961,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513, 33,801,545,  1,545,
+	801,  1,545,545, 33,993,993,225,993,993, 33,609,609,225,993,993,
+	 97,993,993,  1,513,513,  1,769,513,  1,513,769,  1,609,609, 97,
+	993,993,225,993,993,  1,513,513,225,993,993,  1,993,993,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,961,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,993,513,  1,769,769,  1,513,513,129,
+	897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,577,
+	577, 65,961,961,193,961,961,  1,513,513,193,961,961,  1,961,961,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,
+	129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,
+	1017,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,993,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,
+	  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,769,769,
+	  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,
+	513,  1,513,993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,769,
+	769,  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,
+	769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,1009,513,  1,
+	769,769,  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,577,577, 65,961,961,193,961,961,  1,513,513,
+	193,961,961,  1,961,961,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513, 33,801,545,  1,545,801,  1,545,545, 33,993,993,
+	225,993,993, 33,609,609,225,993,993, 97,993,993,  1,513,513,  1,
+	769,513,  1,513,769,  1,609,609, 97,993,993,225,993,993,  1,513,
+	513,225,993,993,  1,993,993,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,
+	513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	993,513,  1,769,769,  1,513,513,129,897,897,  1,897,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,577,577, 65,961,961,193,961,961,
+	  1,513,513,193,961,961,  1,961,961,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,961,513,  1,769,769,  1,513,513,129,897,897,  1,897,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,
+	769,  1,513,513,  1,769,513,  1,513,1009,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,961,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	769,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,993,513,  1,769,769,  1,513,513,129,897,897,  1,897,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,577,577, 65,961,961,
+	193,961,961,  1,513,513,193,961,961,  1,961,961,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,961,513,  1,769,769,  1,513,513,129,897,897,  1,
+	897,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,769,769,  1,513,513,  1,769,513,  1,513,993,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,129,897,897,
+	  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,961,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,1021,513,  1,769,769,  1,513,513,129,897,
+	897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,577,577,
+	 65,961,961,193,961,961,  1,513,513,193,961,961,  1,961,961,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513, 33,801,545,
+	  1,545,801,  1,545,545, 33,993,993,225,993,993, 33,609,609,225,
+	993,993, 97,993,993,  1,513,513,  1,769,513,  1,513,769,  1,609,
+	609, 97,993,993,225,993,993,  1,513,513,225,993,993,  1,993,993,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,
+	129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,
+	961,  1,513,513,  1,769,513,  1,513,769,  1,529,529, 17,913,529,
+	  1,785,785,  1,513,513, 17,785,785,  1,529,913,  1,513,513, 17,
+	785,529,  1,529,785,  1,529,529, 17,1009,1009,241,1009,1009, 17,625,
+	625,241,1009,1009,113,1009,1009,  1,529,529, 17,817,561, 49,561,817,
+	 49,625,625,113,1009,1009,241,1009,1009, 17,561,561,241,1009,1009, 49,
+	1009,1009,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,769,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	 49,817,561,  1,561,817,  1,561,561, 49,1009,1009,241,1009,1009, 49,
+	625,625,241,1009,1009,113,1009,1009,  1,513,513,  1,769,513,  1,513,
+	769,  1,625,625,113,1009,1009,241,1009,1009,  1,513,513,241,1009,1009,
+	  1,1009,1009,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,
+	513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,993,513,  1,769,
+	769,  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,577,577, 65,961,961,193,961,961,  1,513,513,193,
+	961,961,  1,961,961,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,
+	769,769,  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,
+	  1,769,513,  1,513,993,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  9,777,521,  1,521,777,  1,521,521,  9,969,521,
+	  1,777,777,  1,513,513,137,905,905,  1,905,905,  1,513,513,  1,
+	769,513,  1,513,769,  1,521,521,  9,905,905,137,905,905,  1,513,
+	513,  9,777,777,  1,521,969,  1,513,513,  1,769,513,  1,513,769,
+	  1,521,521,  9,905,521,  1,777,777,  1,513,513,  9,777,777,  1,
+	521,905,  1,513,513,  9,777,521,  1,521,777,  1,521,521,  9,1017,
+	1017,249,1017,1017,  9,633,633,249,1017,1017,121,1017,1017,  1,521,521,
+	  9,825,569, 57,569,825, 57,633,633,121,1017,1017,249,1017,1017,  9,
+	569,569,249,1017,1017, 57,1017,1017,  1,513,513,  9,777,521,  1,521,
+	777,  1,521,521,  9,921,537, 25,793,793,  9,537,537,  9,793,793,
+	 25,537,921,  9,537,537, 57,825,569, 25,569,825, 25,569,569, 57,
+	1017,1017,249,1017,1017, 57,633,633,249,1017,1017,121,1017,1017,  1,521,
+	521,  9,793,537, 25,537,793, 25,633,633,121,1017,1017,249,1017,1017,
+	  9,537,537,249,1017,1017, 25,1017,1017,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,961,513,  1,769,769,  1,513,513,129,897,897,  1,897,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,
+	769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,
+	  1,513,769,  1,537,537, 25,921,537,  1,793,793,  1,513,513, 25,
+	793,793,  1,537,921,  1,513,513, 25,793,537,  1,537,793,  1,537,
+	537, 25,1017,1017,249,1017,1017, 25,633,633,249,1017,1017,121,1017,1017,
+	  1,537,537, 25,825,569, 57,569,825, 57,633,633,121,1017,1017,249,
+	1017,1017, 25,569,569,249,1017,1017, 57,1017,1017,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513, 57,825,569,  1,569,825,  1,
+	569,569, 57,1017,1017,249,1017,1017, 57,633,633,249,1017,1017,121,1017,
+	1017,  1,513,513,  1,769,513,  1,513,769,  1,633,633,121,1017,1017,
+	249,1017,1017,  1,513,513,249,1017,1017,  1,1017,1017,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,993,513,  1,513,769,  1,513,513,  1,769,769,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,897,129,897,897,  1,513,513,  1,769,769,  1,513,961,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,
+	769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,993,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,
+	769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,961,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,1009,513,  1,513,769,  1,513,513,
+	  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,513,
+	961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,961,961,193,961,961,  1,577,
+	577,193,961,961, 65,961,961,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,
+	513,993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,
+	513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,769,
+	  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,993,993,225,993,993,
+	  1,609,609,225,993,993, 97,993,993,  1,513,513,  1,801,545, 33,
+	545,801, 33,609,609, 97,993,993,225,993,993,  1,545,545,225,993,
+	993, 33,993,993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,961,193,961,
+	961,  1,577,577,193,961,961, 65,961,961,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,
+	769,769,  1,513,1009,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,
+	513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,993,513,
+	  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,897,129,897,897,  1,513,
+	513,  1,769,769,  1,513,961,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,769,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,
+	961,193,961,961,  1,577,577,193,961,961, 65,961,961,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,897,129,897,897,  1,
+	513,513,  1,769,769,  1,513,993,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	961,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,897,129,897,897,
+	  1,513,513,  1,769,769,  1,513,961,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,1017,1017,249,1017,1017,  1,633,633,249,1017,1017,121,1017,1017,  1,
+	513,513,  1,825,569, 57,569,825, 57,633,633,121,1017,1017,249,1017,
+	1017,  1,569,569,249,1017,1017, 57,1017,1017,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,921,537, 25,793,793,  1,537,537,  1,
+	793,793, 25,537,921,  1,537,537, 57,825,569, 25,569,825, 25,569,
+	569, 57,1017,1017,249,1017,1017, 57,633,633,249,1017,1017,121,1017,1017,
+	  1,513,513,  1,793,537, 25,537,793, 25,633,633,121,1017,1017,249,
+	1017,1017,  1,537,537,249,1017,1017, 25,1017,1017,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,969,521,  9,777,777,  1,521,521,137,905,905,  9,905,
+	905,  1,513,513,  1,777,521,  9,521,777,  1,513,513,  1,905,905,
+	137,905,905,  1,521,521,  1,777,777,  9,521,969,  1,513,513,  1,
+	777,521,  9,521,777,  9,537,537, 25,921,537,  9,793,793,  1,521,
+	521, 25,793,793,  9,537,921,  1,521,521, 25,793,537,  9,537,793,
+	  9,537,537, 25,1017,1017,249,1017,1017, 25,633,633,249,1017,1017,121,
+	1017,1017,  9,537,537, 25,825,569, 57,569,825, 57,633,633,121,1017,
+	1017,249,1017,1017, 25,569,569,249,1017,1017, 57,1017,1017,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,905,521,  9,777,777,  1,
+	521,521,  1,777,777,  9,521,905,  1,521,521, 57,825,569,  9,569,
+	825,  9,569,569, 57,1017,1017,249,1017,1017, 57,633,633,249,1017,1017,
+	121,1017,1017,  1,513,513,  1,777,521,  9,521,777,  9,633,633,121,
+	1017,1017,249,1017,1017,  1,521,521,249,1017,1017,  9,1017,1017,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,
+	769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,961,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,993,513,  1,513,769,  1,513,513,  1,
+	769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,513,961,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,961,961,193,961,961,  1,577,577,
+	193,961,961, 65,961,961,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,513,
+	993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,
+	513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,
+	513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,1009,1009,241,1009,1009,  1,
+	625,625,241,1009,1009,113,1009,1009,  1,513,513,  1,817,561, 49,561,
+	817, 49,625,625,113,1009,1009,241,1009,1009,  1,561,561,241,1009,1009,
+	 49,1009,1009,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	913,529, 17,785,785,  1,529,529,  1,785,785, 17,529,913,  1,529,
+	529, 49,817,561, 17,561,817, 17,561,561, 49,1009,1009,241,1009,1009,
+	 49,625,625,241,1009,1009,113,1009,1009,  1,513,513,  1,785,529, 17,
+	529,785, 17,625,625,113,1009,1009,241,1009,1009,  1,529,529,241,1009,
+	1009, 17,1009,1009,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,
+	769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,
+	769,769,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,993,993,225,
+	993,993,  1,609,609,225,993,993, 97,993,993,  1,513,513,  1,801,
+	545, 33,545,801, 33,609,609, 97,993,993,225,993,993,  1,545,545,
+	225,993,993, 33,993,993,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,769,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,961,
+	193,961,961,  1,577,577,193,961,961, 65,961,961,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,897,129,897,897,  1,513,
+	513,  1,769,769,  1,513,1021,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	993,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,
+	  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,961,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,993,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,961,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,1009,513,  1,513,769,  1,513,513,  1,769,769,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,897,
+	129,897,897,  1,513,513,  1,769,769,  1,513,961,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,961,961,193,961,961,  1,577,577,193,961,961, 65,
+	961,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	897,129,897,897,  1,513,513,  1,769,769,  1,513,993,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,961,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,993,513,  1,769,769,  1,513,513,129,897,
+	897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,577,577,
+	 65,961,961,193,961,961,  1,513,513,193,961,961,  1,961,961,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,129,
+	897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,1009,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,
+	961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,769,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,993,513,  1,769,769,  1,513,
+	513,129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,577,577, 65,961,961,193,961,961,  1,513,513,193,961,961,  1,
+	961,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,769,769,  1,
+	513,513,129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,
+	  1,513,993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,769,769,
+	  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,
+	513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,1017,513,  1,769,
+	769,  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,577,577, 65,961,961,193,961,961,  1,513,513,193,
+	961,961,  1,961,961,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513, 33,801,545,  1,545,801,  1,545,545, 33,993,993,225,
+	993,993, 33,609,609,225,993,993, 97,993,993,  1,513,513,  1,769,
+	513,  1,513,769,  1,609,609, 97,993,993,225,993,993,  1,513,513,
+	225,993,993,  1,993,993,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,
+	  1,769,769,  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,
+	513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,
+	  1,529,529, 17,913,529,  1,785,785,  1,513,513, 17,785,785,  1,
+	529,913,  1,513,513, 17,785,529,  1,529,785,  1,529,529, 17,1009,
+	1009,241,1009,1009, 17,625,625,241,1009,1009,113,1009,1009,  1,529,529,
+	 17,817,561, 49,561,817, 49,625,625,113,1009,1009,241,1009,1009, 17,
+	561,561,241,1009,1009, 49,1009,1009,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513, 49,817,561,  1,561,817,  1,561,561, 49,
+	1009,1009,241,1009,1009, 49,625,625,241,1009,1009,113,1009,1009,  1,513,
+	513,  1,769,513,  1,513,769,  1,625,625,113,1009,1009,241,1009,1009,
+	  1,513,513,241,1009,1009,  1,1009,1009,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,961,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,993,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,897,129,
+	897,897,  1,513,513,  1,769,769,  1,513,961,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,961,961,193,961,961,  1,577,577,193,961,961, 65,961,
+	961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,897,
+	129,897,897,  1,513,513,  1,769,769,  1,513,993,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,769,  1,
+	513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	897,129,897,897,  1,513,513,  1,769,769,  1,513,961,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,1009,1009,241,1009,1009,  1,625,625,241,1009,1009,
+	113,1009,1009,  1,513,513,  1,817,561, 49,561,817, 49,625,625,113,
+	1009,1009,241,1009,1009,  1,561,561,241,1009,1009, 49,1009,1009,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,913,529, 17,785,785,
+	  1,529,529,  1,785,785, 17,529,913,  1,529,529, 49,817,561, 17,
+	561,817, 17,561,561, 49,1009,1009,241,1009,1009, 49,625,625,241,1009,
+	1009,113,1009,1009,  1,513,513,  1,785,529, 17,529,785, 17,625,625,
+	113,1009,1009,241,1009,1009,  1,529,529,241,1009,1009, 17,1009,1009,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,
+	769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,513,961,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,993,993,225,993,993,  1,609,609,
+	225,993,993, 97,993,993,  1,513,513,  1,801,545, 33,545,801, 33,
+	609,609, 97,993,993,225,993,993,  1,545,545,225,993,993, 33,993,
+	993,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,961,961,193,961,961,  1,577,
+	577,193,961,961, 65,961,961,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,
+	513,1017,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,
+	513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,993,513,  1,513,769,
+	  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,897,129,897,897,  1,513,513,  1,769,
+	769,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,769,
+	769,  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,
+	769,513,  1,513,993,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,
+	769,769,  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,
+	  1,769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,1009,513,
+	  1,769,769,  1,513,513,129,897,897,  1,897,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,577,577, 65,961,961,193,961,961,  1,513,
+	513,193,961,961,  1,961,961,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,
+	513,897,  1,513,513, 33,801,545,  1,545,801,  1,545,545, 33,993,
+	993,225,993,993, 33,609,609,225,993,993, 97,993,993,  1,513,513,
+	  1,769,513,  1,513,769,  1,609,609, 97,993,993,225,993,993,  1,
+	513,513,225,993,993,  1,993,993,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	961,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,897,129,897,897,
+	  1,513,513,  1,769,769,  1,513,961,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,
+	769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,993,993,225,993,993,  1,609,609,225,993,993, 97,993,993,  1,
+	513,513,  1,801,545, 33,545,801, 33,609,609, 97,993,993,225,993,
+	993,  1,545,545,225,993,993, 33,993,993,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,
+	769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,961,961,193,961,961,  1,577,577,193,961,961, 65,961,961,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,897,129,
+	897,897,  1,513,513,  1,769,769,  1,513,1009,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,
+	  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,769,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,769,769,  1,513,513,  1,769,513,  1,513,961,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,
+	513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,993,513,  1,769,769,  1,513,513,129,897,897,  1,
+	897,897,  1,513,513,  1,769,513,  1,513,769,  1,577,577, 65,961,
+	961,193,961,961,  1,513,513,193,961,961,  1,961,961,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,961,961,193,961,961,  1,577,577,193,961,961,
+	 65,961,961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,897,129,897,897,  1,513,513,  1,769,769,  1,513,993,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,129,897,
+	897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,513,961,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,769,
+	769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,1023,1023,255,1023,1023,  1,639,639,255,
+	1023,1023,127,1023,1023,  1,513,513,  1,831,575, 63,575,831, 63,639,
+	639,127,1023,1023,255,1023,1023,  1,575,575,255,1023,1023, 63,1023,1023,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,927,543, 31,
+	799,799,  1,543,543,  1,799,799, 31,543,927,  1,543,543, 63,831,
+	575, 31,575,831, 31,575,575, 63,1023,1023,255,1023,1023, 63,639,639,
+	255,1023,1023,127,1023,1023,  1,513,513,  1,799,543, 31,543,799, 31,
+	639,639,127,1023,1023,255,1023,1023,  1,543,543,255,1023,1023, 31,1023,
+	1023,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,975,527, 15,783,783,  1,527,
+	527,143,911,911, 15,911,911,  1,513,513,  1,783,527, 15,527,783,
+	  1,513,513,  1,911,911,143,911,911,  1,527,527,  1,783,783, 15,
+	527,975,  1,513,513,  1,783,527, 15,527,783, 15,543,543, 31,927,
+	543, 15,799,799,  1,527,527, 31,799,799, 15,543,927,  1,527,527,
+	 31,799,543, 15,543,799, 15,543,543, 31,1023,1023,255,1023,1023, 31,
+	639,639,255,1023,1023,127,1023,1023, 15,543,543, 31,831,575, 63,575,
+	831, 63,639,639,127,1023,1023,255,1023,1023, 31,575,575,255,1023,1023,
+	 63,1023,1023,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	911,527, 15,783,783,  1,527,527,  1,783,783, 15,527,911,  1,527,
+	527, 63,831,575, 15,575,831, 15,575,575, 63,1023,1023,255,1023,1023,
+	 63,639,639,255,1023,1023,127,1023,1023,  1,513,513,  1,783,527, 15,
+	527,783, 15,639,639,127,1023,1023,255,1023,1023,  1,527,527,255,1023,
+	1023, 15,1023,1023,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,961,513,  1,513,
+	769,  1,513,513,  1,769,769,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,769,769,  1,513,513,  1,
+	769,513,  1,513,961,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,999,519,  7,
+	775,775,  1,519,519,135,903,903,  7,903,903,  1,513,513,  1,775,
+	519,  7,519,775,  7,583,583, 71,967,967,199,967,967,  1,519,519,
+	199,967,967,  7,967,967,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,903,519,  7,519,775,  1,519,519,  1,775,775,  7,519,
+	903,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,967,967,
+	199,967,967,  1,583,583,199,967,967, 71,967,967,  1,513,513,  1,
+	775,519,  7,519,775,  1,513,513,  1,903,903,135,903,903,  1,519,
+	519,  1,775,775,  7,519,999,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,903,519,  7,519,775,  1,519,519,  1,775,519,  7,
+	519,903,  1,519,519, 15,783,527,  7,527,783,  7,527,527, 15,975,
+	527,  7,783,783,  1,519,519,143,911,911,  7,911,911,  1,513,513,
+	  1,775,519,  7,519,775,  7,527,527, 15,911,911,143,911,911,  1,
+	519,519, 15,783,783,  7,527,975,  1,513,513,  1,775,519,  7,519,
+	775,  7,527,527, 15,911,527,  7,783,783,  1,519,519, 15,783,783,
+	  7,527,911,  1,519,519, 15,783,527,  7,527,783,  7,527,527, 15,
+	1023,1023,255,1023,1023, 15,639,639,255,1023,1023,127,1023,1023,  7,527,
+	527, 15,831,575, 63,575,831, 63,639,639,127,1023,1023,255,1023,1023,
+	 15,575,575,255,1023,1023, 63,1023,1023,  1,519,519, 15,783,527,  7,
+	527,783,  7,527,527, 15,927,543, 31,799,799, 15,543,543, 15,799,
+	799, 31,543,927, 15,543,543, 63,831,575, 31,575,831, 31,575,575,
+	 63,1023,1023,255,1023,1023, 63,639,639,255,1023,1023,127,1023,1023,  7,
+	527,527, 15,799,543, 31,543,799, 31,639,639,127,1023,1023,255,1023,
+	1023, 15,543,543,255,1023,1023, 31,1023,1023,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,513,513,  1,
+	769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,967,519,  7,775,775,  1,519,519,135,903,903,  7,903,903,
+	  1,513,513,  1,775,519,  7,519,775,  1,513,513,  1,903,903,135,
+	903,903,  1,519,519,  1,775,775,  7,519,967,  1,513,513,  1,775,
+	519,  7,519,775,  7,543,543, 31,927,543,  7,799,799,  1,519,519,
+	 31,799,799,  7,543,927,  1,519,519, 31,799,543,  7,543,799,  7,
+	543,543, 31,1023,1023,255,1023,1023, 31,639,639,255,1023,1023,127,1023,
+	1023,  7,543,543, 31,831,575, 63,575,831, 63,639,639,127,1023,1023,
+	255,1023,1023, 31,575,575,255,1023,1023, 63,1023,1023,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,903,519,  7,775,775,  1,519,
+	519,  1,775,775,  7,519,903,  1,519,519, 63,831,575,  7,575,831,
+	  7,575,575, 63,1023,1023,255,1023,1023, 63,639,639,255,1023,1023,127,
+	1023,1023,  1,513,513,  1,775,519,  7,519,775,  7,639,639,127,1023,
+	1023,255,1023,1023,  1,519,519,255,1023,1023,  7,1023,1023,  1,513,513,
+	  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,  1,
+	513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,769,513,
+	  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,961,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,769,
+	  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,993,513,  1,513,769,  1,513,513,  1,769,
+	769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,897,129,897,897,  1,513,513,  1,769,769,  1,513,961,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,129,
+	897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,993,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,961,513,  1,769,769,  1,513,513,
+	129,897,897,  1,897,897,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,
+	961,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,
+	  1,769,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,1011,515,  3,771,771,  1,515,
+	515,131,899,899,  3,899,899,  1,513,513,  1,771,515,  3,515,771,
+	  3,579,579, 67,963,963,195,963,963,  1,515,515,195,963,963,  3,
+	963,963,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,899,
+	515,  3,771,771,  1,515,515,  1,771,515,  3,515,899,  1,515,515,
+	 35,803,547,  3,547,803,  3,547,547, 35,995,995,227,995,995, 35,
+	611,611,227,995,995, 99,995,995,  1,513,513,  1,771,515,  3,515,
+	771,  3,611,611, 99,995,995,227,995,995,  1,515,515,227,995,995,
+	  3,995,995,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,
+	897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,  1,513,
+	513,  1,769,513,  1,513,769,  1,513,513,  1,963,515,  3,515,771,
+	  1,515,515,  1,771,771,  3,515,899,  1,513,513,  1,771,515,  3,
+	515,771,  1,513,513,  1,899,899,131,899,899,  1,515,515,  1,771,
+	771,  3,515,963,  1,513,513,  1,769,513,  1,513,769,  1,513,513,
+	  1,897,513,  1,513,769,  1,513,513,  1,769,769,  1,513,897,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,995,995,227,995,
+	995,  1,611,611,227,995,995, 99,995,995,  1,513,513,  1,803,547,
+	 35,547,803, 35,611,611, 99,995,995,227,995,995,  1,547,547,227,
+	995,995, 35,995,995,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,899,515,  3,515,771,  1,515,515,  1,771,771,  3,515,899,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,963,963,195,
+	963,963,  1,579,579,195,963,963, 67,963,963,  1,513,513,  1,771,
+	515,  3,515,771,  1,513,513,  1,899,899,131,899,899,  1,515,515,
+	  1,771,771,  3,515,1011,  1,513,513,  1,769,513,  1,513,769,  1,
+	513,513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,
+	897,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,963,515,
+	  3,515,771,  1,515,515,  3,771,771,  3,515,899,  1,513,513,  1,
+	771,515,  3,515,771,  1,513,513,  1,899,515,  3,771,771,  1,515,
+	515,  1,771,515,  3,515,963,  1,513,513,  1,771,515,  3,515,771,
+	  3,519,519,  7,903,519,  3,775,775,  1,515,515,  7,775,519,  3,
+	519,903,  1,515,515,  7,775,519,  3,519,775,  3,519,519,  7,999,
+	519,  3,775,775,  1,515,515,135,903,903,  3,903,903,  1,513,513,
+	  1,771,515,  3,515,771,  3,583,583, 71,967,967,199,967,967,  1,
+	515,515,199,967,967,  3,967,967,  1,513,513,  1,769,513,  1,513,
+	769,  1,513,513,  1,899,515,  3,515,771,  1,515,515,  1,771,771,
+	  3,515,899,  1,515,515,  7,775,519,  3,519,775,  3,519,519,  7,
+	967,967,199,967,967,  7,583,583,199,967,967, 71,967,967,  1,513,
+	513,  1,771,515,  3,515,771,  3,519,519,  7,903,903,135,903,903,
+	  1,515,515,  7,775,775,  3,519,999,  1,513,513,  1,769,513,  1,
+	513,769,  1,513,513,  1,899,515,  3,515,771,  1,515,515,  1,771,
+	515,  3,515,899,  1,515,515,  7,775,519,  3,519,775,  3,519,519,
+	  7,967,519,  3,775,775,  1,515,515,135,903,903,  3,903,903,  1,
+	513,513,  1,771,515,  3,515,771,  3,519,519,  7,903,903,135,903,
+	903,  1,515,515,  7,775,775,  3,519,967,  1,513,513,  1,771,515,
+	  3,515,771,  3,519,519,  7,903,519,  3,775,775,  1,515,515,  7,
+	775,775,  3,519,903,  1,515,515,  7,775,519,  3,519,775,  3,519,
+	519,  7,1023,1023,255,1023,1023,  7,639,639,255,1023,1023,127,1023,1023,
+	  3,519,519,  7,831,575, 63,575,831, 63,639,639,127,1023,1023,255,
+	1023,1023,  7,575,575,255,1023,1023, 63,1023,1023,  1,515,515,  7,775,
+	519,  3,519,775,  3,519,519,  7,927,543, 31,799,799,  7,543,543,
+	  7,799,799, 31,543,927,  7,543,543, 63,831,575, 31,575,831, 31,
+	575,575, 63,1023,1023,255,1023,1023, 63,639,639,255,1023,1023,127,1023,
+	1023,  3,519,519,  7,799,543, 31,543,799, 31,639,639,127,1023,1023,
+	255,1023,1023,  7,543,543,255,1023,1023, 31,1023,1023,  1,513,513,  1,
+	771,515,  3,515,771,  3,519,519,  7,903,519,  3,519,775,  1,515,
+	515,  7,775,519,  3,519,903,  1,515,515,  7,775,519,  3,519,775,
+	  3,519,519,  7,975,527, 15,783,783,  7,527,527,143,911,911, 15,
+	911,911,  3,519,519,  7,783,527, 15,527,783,  3,519,519,  7,911,
+	911,143,911,911,  7,527,527,  7,783,783, 15,527,975,  3,519,519,
+	  7,783,527, 15,527,783, 15,543,543, 31,927,543, 15,799,799,  7,
+	527,527, 31,799,799, 15,543,927,  7,527,527, 31,799,543, 15,543,
+	799, 15,543,543, 31,1023,1023,255,1023,1023, 31,639,639,255,1023,1023,
+	127,1023,1023, 15,543,543, 31,831,575, 63,575,831, 63,639,639,127,
+	1023,1023,255,1023,1023, 31,575,575,255,1023,1023, 63,1023,1023,  1,515,
+	515,  7,775,519,  3,519,775,  3,519,519,  7,911,527, 15,783,783,
+	  7,527,527,  7,783,783, 15,527,911,  7,527,527, 63,831,575, 15,
+	575,831, 15,575,575, 63,1023,1023,255,1023,1023, 63,639,639,255,1023,
+	1023,127,1023,1023,  3,519,519,  7,783,527, 15,527,783, 15,639,639,
+	127,1023,1023,255,1023,1023,  7,527,527,255,1023,1023, 15,1023,1023,  1,
+	513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,513,
+	769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,513,
+	  1,513,769,  1,513,513,  1,961,513,  1,513,769,  1,513,513,  1,
+	769,769,  1,513,897,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,769,769,  1,513,513,  1,769,513,  1,513,961,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,897,513,  1,
+	769,769,  1,513,513,  1,769,513,  1,513,897,  1,513,513,  1,769,
+	513,  1,513,769,  1,513,513,  1,995,515,  3,771,771,  1,515,515,
+	131,899,899,  3,899,899,  1,513,513,  1,771,515,  3,515,771,  3,
+	579,579, 67,963,963,195,963,963,  1,515,515,195,963,963,  3,963,
+	963,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,899,515,
+	  3,515,771,  1,515,515,  1,771,771,  3,515,899,  1,513,513,  1,
+	769,513,  1,513,769,  1,513,513,  1,963,963,195,963,963,  1,579,
+	579,195,963,963, 67,963,963,  1,513,513,  1,771,515,  3,515,771,
+	  1,513,513,  1,899,899,131,899,899,  1,515,515,  1,771,771,  3,
+	515,995,  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,899,
+	515,  3,515,771,  1,515,515,  1,771,515,  3,515,899,  1,515,515,
+	 15,783,527,  3,527,783,  3,527,527, 15,975,527,  3,783,783,  1,
+	515,515,143,911,911,  3,911,911,  1,513,513,  1,771,515,  3,515,
+	771,  3,527,527, 15,911,911,143,911,911,  1,515,515, 15,783,783,
+	  3,527,975,  1,513,513,  1,771,515,  3,515,771,  3,527,527, 15,
+	911,527,  3,783,783,  1,515,515, 15,783,783,  3,527,911,  1,515,
+	515, 15,783,527,  3,527,783,  3,527,527, 15,1023,1023,255,1023,1023,
+	 15,639,639,255,1023,1023,127,1023,1023,  3,527,527, 15,831,575, 63,
+	575,831, 63,639,639,127,1023,1023,255,1023,1023, 15,575,575,255,1023,
+	1023, 63,1023,1023,  1,515,515, 15,783,527,  3,527,783,  3,527,527,
+	 15,927,543, 31,799,799, 15,543,543, 15,799,799, 31,543,927, 15,
+	543,543, 63,831,575, 31,575,831, 31,575,575, 63,1023,1023,255,1023,
+	1023, 63,639,639,255,1023,1023,127,1023,1023,  3,527,527, 15,799,543,
+	 31,543,799, 31,639,639,127,1023,1023,255,1023,1023, 15,543,543,255,
+	1023,1023, 31,1023,1023,  1,513,513,  1,769,513,  1,513,769,  1,513,
+	513,  1,897,513,  1,513,769,  1,513,513,  1,769,513,  1,513,897,
+	  1,513,513,  1,769,513,  1,513,769,  1,513,513,  1,963,515,  3,
+	771,771,  1,515,515,131,899,899,  3,899,899,  1,513,513,  1,771,
+	515,  3,515,771,  1,513,513,  1,899,899,131,899,899,  1,515,515,
+	  1,771,771,  3,515,963,  1,513,513,  1,771,515,  3,515,771,  3,
+	543,543, 31,927,543,  3,799,799,  1,515,515, 31,799,799,  3,543,
+	927,  1,515,515, 31,799,543,  3,543,799,  3,543,543, 31,1023,1023,
+	255,1023,1023, 31,639,639,255,1023,1023,127,1023,1023,  3,543,543, 31,
+	831,575, 63,575,831, 63,639,639,127,1023,1023,255,1023,1023, 31,575,
+	575,255,1023,1023, 63,1023,1023,  1,513,513,  1,769,513,  1,513,769,
+	  1,513,513,  1,899,515,  3,771,771,  1,515,515,  1,771,771,  3,
+	515,899,  1,515,515, 63,831,575,  3,575,831,  3,575,575, 63,1023,
+	1023,255,1023,1023, 63,639,639,255,1023,1023,127,1023,1023,  1,513,513,
+	  1,771,515,  3,515,771,  3,639,639,127,1023,1023,255,1023,1023,  1,
+	515,515,255,1023,1023,  3,1023,1023,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,515,
+	  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,
+	963,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,
+	  3,515,515,  3,771,515,  3,515,963,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,
+	515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,
+	  3,995,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,  3,
+	515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,771,
+	771,  3,515,515,  3,771,515,  3,515,963,  3,515,515,  3,771,515,
+	  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,
+	771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,963,515,  3,515,771,  3,515,515,  3,771,771,  3,515,899,
+	  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,
+	515,771,  3,515,515,  3,771,515,  3,515,995,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,
+	  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,963,515,  3,515,771,  3,515,515,  3,771,771,  3,515,
+	899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,
+	  3,515,771,  3,515,515,  3,771,515,  3,515,963,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,
+	515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,
+	  3,515,515,  3,1011,515,  3,515,771,  3,515,515,  3,771,771,  3,
+	515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,
+	899,131,899,899,  3,515,515,  3,771,771,  3,515,963,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,
+	515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,963,963,195,963,963,  3,579,579,195,963,963,
+	 67,963,963,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,
+	899,899,131,899,899,  3,515,515,  3,771,771,  3,515,995,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,
+	  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,963,515,  3,515,771,  3,515,515,  3,771,
+	515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,
+	  3,899,515,  3,771,771,  3,515,515,  3,771,515,  3,515,963,  3,
+	515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,
+	771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,
+	  3,515,771,  3,515,515,  3,995,515,  3,771,771,  3,515,515,131,
+	899,899,  3,899,899,  3,515,515,  3,771,515,  3,515,771,  3,579,
+	579, 67,963,963,195,963,963,  3,515,515,195,963,963,  3,963,963,
+	  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,
+	515,771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,963,515,  3,771,771,  3,515,515,
+	131,899,899,  3,899,899,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,899,515,  3,771,771,  3,515,515,  3,771,515,  3,515,
+	1011,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,
+	  3,515,771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,963,515,  3,515,771,  3,515,
+	515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,
+	  3,515,515,  3,899,515,  3,771,771,  3,515,515,  3,771,515,  3,
+	515,963,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,
+	515,  3,771,771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,995,515,  3,771,771,  3,
+	515,515,131,899,899,  3,899,899,  3,515,515,  3,771,515,  3,515,
+	771,  3,579,579, 67,963,963,195,963,963,  3,515,515,195,963,963,
+	  3,963,963,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,
+	899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,963,515,  3,771,771,
+	  3,515,515,131,899,899,  3,899,899,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,899,515,  3,771,771,  3,515,515,  3,771,
+	515,  3,515,995,  3,515,515,  3,771,515,  3,515,771,  3,515,515,
+	  3,899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,  3,
+	515,515,  3,771,515,  3,515,771,  3,515,515,  3,963,515,  3,771,
+	771,  3,515,515,131,899,899,  3,899,899,  3,515,515,  3,771,515,
+	  3,515,771,  3,515,515,  3,899,515,  3,771,771,  3,515,515,  3,
+	771,515,  3,515,963,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,899,515,  3,771,771,  3,515,515,  3,771,515,  3,515,899,
+	  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,1019,515,  3,
+	771,771,  3,515,515,131,899,899,  3,899,899,  3,515,515,  3,771,
+	515,  3,515,771,  3,579,579, 67,963,963,195,963,963,  3,515,515,
+	195,963,963,  3,963,963,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,899,515,  3,771,771,  3,515,515,  3,771,515,  3,515,
+	899,  3,515,515, 35,803,547,  3,547,803,  3,547,547, 35,995,995,
+	227,995,995, 35,611,611,227,995,995, 99,995,995,  3,515,515,  3,
+	771,515,  3,515,771,  3,611,611, 99,995,995,227,995,995,  3,515,
+	515,227,995,995,  3,995,995,  3,515,515,  3,771,515,  3,515,771,
+	  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,515,  3,
+	515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,963,
+	515,  3,771,771,  3,515,515,131,899,899,  3,899,899,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,771,771,  3,
+	515,515,  3,771,515,  3,515,963,  3,515,515,  3,771,515,  3,515,
+	771,  3,531,531, 19,915,531,  3,787,787,  3,515,515, 19,787,787,
+	  3,531,915,  3,515,515, 19,787,531,  3,531,787,  3,531,531, 19,
+	1011,1011,243,1011,1011, 19,627,627,243,1011,1011,115,1011,1011,  3,531,
+	531, 19,819,563, 51,563,819, 51,627,627,115,1011,1011,243,1011,1011,
+	 19,563,563,243,1011,1011, 51,1011,1011,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,899,515,  3,771,771,  3,515,515,  3,771,
+	515,  3,515,899,  3,515,515, 51,819,563,  3,563,819,  3,563,563,
+	 51,1011,1011,243,1011,1011, 51,627,627,243,1011,1011,115,1011,1011,  3,
+	515,515,  3,771,515,  3,515,771,  3,627,627,115,1011,1011,243,1011,
+	1011,  3,515,515,243,1011,1011,  3,1011,1011,  3,515,515,  3,771,515,
+	  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,
+	771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,963,515,  3,515,771,  3,515,515,  3,771,771,  3,515,899,
+	  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,
+	515,771,  3,515,515,  3,771,515,  3,515,963,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,
+	  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,995,515,  3,515,771,  3,515,515,  3,771,771,  3,515,
+	899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,899,
+	131,899,899,  3,515,515,  3,771,771,  3,515,963,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,
+	515,  3,771,771,  3,515,899,  3,515,515,  3,771,515,  3,515,771,
+	  3,515,515,  3,963,963,195,963,963,  3,579,579,195,963,963, 67,
+	963,963,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,
+	899,131,899,899,  3,515,515,  3,771,771,  3,515,995,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,
+	515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,963,515,  3,515,771,  3,515,515,  3,771,771,
+	  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,
+	899,899,131,899,899,  3,515,515,  3,771,771,  3,515,963,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,
+	  3,515,515,  3,771,771,  3,515,899,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,1011,1011,243,1011,1011,  3,627,627,243,1011,
+	1011,115,1011,1011,  3,515,515,  3,819,563, 51,563,819, 51,627,627,
+	115,1011,1011,243,1011,1011,  3,563,563,243,1011,1011, 51,1011,1011,  3,
+	515,515,  3,771,515,  3,515,771,  3,515,515,  3,915,531, 19,787,
+	787,  3,531,531,  3,787,787, 19,531,915,  3,531,531, 51,819,563,
+	 19,563,819, 19,563,563, 51,1011,1011,243,1011,1011, 51,627,627,243,
+	1011,1011,115,1011,1011,  3,515,515,  3,787,531, 19,531,787, 19,627,
+	627,115,1011,1011,243,1011,1011,  3,531,531,243,1011,1011, 19,1011,1011,
+	  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,
+	515,771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,963,515,  3,515,771,  3,515,515,
+	  3,771,771,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,899,899,131,899,899,  3,515,515,  3,771,771,  3,515,
+	963,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,
+	  3,515,771,  3,515,515,  3,771,771,  3,515,899,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,995,995,227,995,995,  3,611,
+	611,227,995,995, 99,995,995,  3,515,515,  3,803,547, 35,547,803,
+	 35,611,611, 99,995,995,227,995,995,  3,547,547,227,995,995, 35,
+	995,995,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,
+	515,  3,515,771,  3,515,515,  3,771,771,  3,515,899,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,963,963,195,963,963,  3,
+	579,579,195,963,963, 67,963,963,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,899,899,131,899,899,  3,515,515,  3,771,771,
+	  3,515,1019,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,
+	899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,963,515,  3,515,771,
+	  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,
+	515,  3,515,963,  3,515,515,  3,771,515,  3,515,771,  3,515,515,
+	  3,899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,  3,
+	515,515,  3,771,515,  3,515,771,  3,515,515,  3,995,515,  3,515,
+	771,  3,515,515,  3,771,771,  3,515,899,  3,515,515,  3,771,515,
+	  3,515,771,  3,515,515,  3,899,899,131,899,899,  3,515,515,  3,
+	771,771,  3,515,963,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,
+	  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,963,515,  3,
+	771,771,  3,515,515,131,899,899,  3,899,899,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,899,515,  3,771,771,  3,515,515,
+	  3,771,515,  3,515,995,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,
+	899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,963,515,
+	  3,771,771,  3,515,515,131,899,899,  3,899,899,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,899,515,  3,771,771,  3,515,
+	515,  3,771,515,  3,515,963,  3,515,515,  3,771,515,  3,515,771,
+	  3,515,515,  3,899,515,  3,771,771,  3,515,515,  3,771,515,  3,
+	515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,1011,
+	515,  3,771,771,  3,515,515,131,899,899,  3,899,899,  3,515,515,
+	  3,771,515,  3,515,771,  3,579,579, 67,963,963,195,963,963,  3,
+	515,515,195,963,963,  3,963,963,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,899,515,  3,771,771,  3,515,515,  3,771,515,
+	  3,515,899,  3,515,515, 35,803,547,  3,547,803,  3,547,547, 35,
+	995,995,227,995,995, 35,611,611,227,995,995, 99,995,995,  3,515,
+	515,  3,771,515,  3,515,771,  3,611,611, 99,995,995,227,995,995,
+	  3,515,515,227,995,995,  3,995,995,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,771,
+	515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,
+	  3,963,515,  3,515,771,  3,515,515,  3,771,771,  3,515,899,  3,
+	515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,899,131,899,
+	899,  3,515,515,  3,771,771,  3,515,963,  3,515,515,  3,771,515,
+	  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,  3,
+	771,771,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,995,995,227,995,995,  3,611,611,227,995,995, 99,995,995,
+	  3,515,515,  3,803,547, 35,547,803, 35,611,611, 99,995,995,227,
+	995,995,  3,547,547,227,995,995, 35,995,995,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,
+	  3,771,771,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,963,963,195,963,963,  3,579,579,195,963,963, 67,963,
+	963,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,899,
+	131,899,899,  3,515,515,  3,771,771,  3,515,1011,  3,515,515,  3,
+	771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,
+	515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,
+	  3,515,515,  3,963,515,  3,515,771,  3,515,515,  3,771,771,  3,
+	515,899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,
+	515,  3,771,771,  3,515,515,  3,771,515,  3,515,963,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,771,771,  3,
+	515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,995,515,  3,771,771,  3,515,515,131,899,899,
+	  3,899,899,  3,515,515,  3,771,515,  3,515,771,  3,579,579, 67,
+	963,963,195,963,963,  3,515,515,195,963,963,  3,963,963,  3,515,
+	515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,
+	  3,515,515,  3,771,771,  3,515,899,  3,515,515,  3,771,515,  3,
+	515,771,  3,515,515,  3,963,963,195,963,963,  3,579,579,195,963,
+	963, 67,963,963,  3,515,515,  3,771,515,  3,515,771,  3,515,515,
+	  3,899,899,131,899,899,  3,515,515,  3,771,771,  3,515,995,  3,
+	515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,515,
+	771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,  3,771,515,
+	  3,515,771,  3,515,515,  3,963,515,  3,771,771,  3,515,515,131,
+	899,899,  3,899,899,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,899,899,131,899,899,  3,515,515,  3,771,771,  3,515,963,
+	  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,515,  3,
+	771,771,  3,515,515,  3,771,771,  3,515,899,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,1023,1023,255,1023,1023,  3,639,639,
+	255,1023,1023,127,1023,1023,  3,515,515,  3,831,575, 63,575,831, 63,
+	639,639,127,1023,1023,255,1023,1023,  3,575,575,255,1023,1023, 63,1023,
+	1023,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,927,543,
+	 31,799,799,  3,543,543,  3,799,799, 31,543,927,  3,543,543, 63,
+	831,575, 31,575,831, 31,575,575, 63,1023,1023,255,1023,1023, 63,639,
+	639,255,1023,1023,127,1023,1023,  3,515,515,  3,799,543, 31,543,799,
+	 31,639,639,127,1023,1023,255,1023,1023,  3,543,543,255,1023,1023, 31,
+	1023,1023,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,899,
+	515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,975,527, 15,783,783,  3,
+	527,527,143,911,911, 15,911,911,  3,515,515,  3,783,527, 15,527,
+	783,  3,515,515,  3,911,911,143,911,911,  3,527,527,  3,783,783,
+	 15,527,975,  3,515,515,  3,783,527, 15,527,783, 15,543,543, 31,
+	927,543, 15,799,799,  3,527,527, 31,799,799, 15,543,927,  3,527,
+	527, 31,799,543, 15,543,799, 15,543,543, 31,1023,1023,255,1023,1023,
+	 31,639,639,255,1023,1023,127,1023,1023, 15,543,543, 31,831,575, 63,
+	575,831, 63,639,639,127,1023,1023,255,1023,1023, 31,575,575,255,1023,
+	1023, 63,1023,1023,  3,515,515,  3,771,515,  3,515,771,  3,515,515,
+	  3,911,527, 15,783,783,  3,527,527,  3,783,783, 15,527,911,  3,
+	527,527, 63,831,575, 15,575,831, 15,575,575, 63,1023,1023,255,1023,
+	1023, 63,639,639,255,1023,1023,127,1023,1023,  3,515,515,  3,783,527,
+	 15,527,783, 15,639,639,127,1023,1023,255,1023,1023,  3,527,527,255,
+	1023,1023, 15,1023,1023,  3,515,515,  3,771,515,  3,515,771,  3,515,
+	515,  3,899,515,  3,515,771,  3,515,515,  3,771,515,  3,515,899,
+	  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,963,515,  3,
+	515,771,  3,515,515,  3,771,771,  3,515,899,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,899,515,  3,771,771,  3,515,515,
+	  3,771,515,  3,515,963,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,899,515,  3,771,771,  3,515,515,  3,771,515,  3,515,
+	899,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,999,519,
+	  7,775,775,  3,519,519,135,903,903,  7,903,903,  3,515,515,  3,
+	775,519,  7,519,775,  7,583,583, 71,967,967,199,967,967,  3,519,
+	519,199,967,967,  7,967,967,  3,515,515,  3,771,515,  3,515,771,
+	  3,515,515,  3,903,519,  7,519,775,  3,519,519,  3,775,775,  7,
+	519,903,  3,515,515,  3,771,515,  3,515,771,  3,515,515,  3,967,
+	967,199,967,967,  3,583,583,199,967,967, 71,967,967,  3,515,515,
+	  3,775,519,  7,519,775,  3,515,515,  3,903,903,135,903,903,  3,
+	519,519,  3,775,775,  7,519,999,  3,515,515,  3,771,515,  3,515,
+	771,  3,515,515,  3,903,519,  7,519,775,  3,519,519,  3,775,519,
+	  7,519,903,  3,519,519, 15,783,527,  7,527,783,  7,527,527, 15,
+	975,527,  7,783,783,  3,519,519,143,911,911,  7,911,911,  3,515,
+	515,  3,775,519,  7,519,775,  7,527,527, 15,911,911,143,911,911,
+	  3,519,519, 15,783,783,  7,527,975,  3,515,515,  3,775,519,  7,
+	519,775,  7,527,527, 15,911,527,  7,783,783,  3,519,519, 15,783,
+	783,  7,527,911,  3,519,519, 15,783,527,  7,527,783,  7,527,527,
+	 15,1023,1023,255,1023,1023, 15,639,639,255,1023,1023,127,1023,1023,  7,
+	527,527, 15,831,575, 63,575,831, 63,639,639,127,1023,1023,255,1023,
+	1023, 15,575,575,255,1023,1023, 63,1023,1023,  3,519,519, 15,783,527,
+	  7,527,783,  7,527,527, 15,927,543, 31,799,799, 15,543,543, 15,
+	799,799, 31,543,927, 15,543,543, 63,831,575, 31,575,831, 31,575,
+	575, 63,1023,1023,255,1023,1023, 63,639,639,255,1023,1023,127,1023,1023,
+	  7,527,527, 15,799,543, 31,543,799, 31,639,639,127,1023,1023,255,
+	1023,1023, 15,543,543,255,1023,1023, 31,1023,1023,  3,515,515,  3,771,
+	515,  3,515,771,  3,515,515,  3,899,515,  3,515,771,  3,515,515,
+	  3,771,515,  3,515,899,  3,515,515,  3,771,515,  3,515,771,  3,
+	515,515,  3,967,519,  7,775,775,  3,519,519,135,903,903,  7,903,
+	903,  3,515,515,  3,775,519,  7,519,775,  3,515,515,  3,903,903,
+	135,903,903,  3,519,519,  3,775,775,  7,519,967,  3,515,515,  3,
+	775,519,  7,519,775,  7,543,543, 31,927,543,  7,799,799,  3,519,
+	519, 31,799,799,  7,543,927,  3,519,519, 31,799,543,  7,543,799,
+	  7,543,543, 31,1023,1023,255,1023,1023, 31,639,639,255,1023,1023,127,
+	1023,1023,  7,543,543, 31,831,575, 63,575,831, 63,639,639,127,1023,
+	1023,255,1023,1023, 31,575,575,255,1023,1023, 63,1023,1023,  3,515,515,
+	  3,771,515,  3,515,771,  3,515,515,  3,903,519,  7,775,775,  3,
+	519,519,  3,775,775,  7,519,903,  3,519,519, 63,831,575,  7,575,
+	831,  7,575,575, 63,1023,1023,255,1023,1023, 63,639,639,255,1023,1023,
+	127,1023,1023,  3,515,515,  3,775,519,  7,519,775,  7,639,639,127,
+	1023,1023,255,1023,1023,  3,519,519,255,1023,1023,  7,1023,1023,  7,519,
+	519,  7,775,519,  7,519,775,  7,519,519,  7,903,519,  7,519,775,
+	  7,519,519,  7,775,519,  7,519,903,  7,519,519,  7,775,519,  7,
+	519,775,  7,519,519,  7,967,519,  7,519,775,  7,519,519,  7,775,
+	519,  7,519,903,  7,519,519,  7,775,519,  7,519,775,  7,519,519,
+	  7,903,519,  7,519,775,  7,519,519,  7,775,519,  7,519,967,  7,
+	519,519,  7,775,519,  7,519,775,  7,519,519,  7,903,519,  7,519,
+	775,  7,519,519,  7,775,519,  7,519,903,  7,519,519,  7,775,519,
+	  7,519,775,  7,519,519,  7,999,519,  7,519,775,  7,519,519,  7,
+	775,775,  7,519,903,  7,519,519,  7,775,519,  7,519,775,  7,519,
+	519,  7,903,903,135,903,903,  7,519,519,  7,775,775,  7,519,967,
+	  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,903,519,  7,
+	519,775,  7,519,519,  7,775,519,  7,519,903,  7,519,519,  7,775,
+	519,  7,519,775,  7,519,519,  7,967,519,  7,775,775,  7,519,519,
+	135,903,903,  7,903,903,  7,519,519,  7,775,519,  7,519,775,  7,
+	519,519,  7,903,519,  7,775,775,  7,519,519,  7,775,519,  7,519,
+	999,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,903,519,
+	  7,519,775,  7,519,519,  7,775,519,  7,519,903,  7,519,519,  7,
+	775,519,  7,519,775,  7,519,519,  7,967,519,  7,775,775,  7,519,
+	519,135,903,903,  7,903,903,  7,519,519,  7,775,519,  7,519,775,
+	  7,519,519,  7,903,519,  7,775,775,  7,519,519,  7,775,519,  7,
+	519,967,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,903,
+	519,  7,775,775,  7,519,519,  7,775,519,  7,519,903,  7,519,519,
+	  7,775,519,  7,519,775,  7,519,519,  7,1015,519,  7,775,775,  7,
+	519,519,135,903,903,  7,903,903,  7,519,519,  7,775,519,  7,519,
+	775,  7,583,583, 71,967,967,199,967,967,  7,519,519,199,967,967,
+	  7,967,967,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,
+	903,519,  7,775,775,  7,519,519,  7,775,519,  7,519,903,  7,519,
+	519, 39,807,551,  7,551,807,  7,551,551, 39,999,999,231,999,999,
+	 39,615,615,231,999,999,103,999,999,  7,519,519,  7,775,519,  7,
+	519,775,  7,615,615,103,999,999,231,999,999,  7,519,519,231,999,
+	999,  7,999,999,  7,519,519,  7,775,519,  7,519,775,  7,519,519,
+	  7,903,519,  7,519,775,  7,519,519,  7,775,519,  7,519,903,  7,
+	519,519,  7,775,519,  7,519,775,  7,519,519,  7,967,519,  7,519,
+	775,  7,519,519,  7,775,775,  7,519,903,  7,519,519,  7,775,519,
+	  7,519,775,  7,519,519,  7,903,903,135,903,903,  7,519,519,  7,
+	775,775,  7,519,967,  7,519,519,  7,775,519,  7,519,775,  7,519,
+	519,  7,903,519,  7,519,775,  7,519,519,  7,775,775,  7,519,903,
+	  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,999,999,231,
+	999,999,  7,615,615,231,999,999,103,999,999,  7,519,519,  7,807,
+	551, 39,551,807, 39,615,615,103,999,999,231,999,999,  7,551,551,
+	231,999,999, 39,999,999,  7,519,519,  7,775,519,  7,519,775,  7,
+	519,519,  7,903,519,  7,519,775,  7,519,519,  7,775,775,  7,519,
+	903,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,967,967,
+	199,967,967,  7,583,583,199,967,967, 71,967,967,  7,519,519,  7,
+	775,519,  7,519,775,  7,519,519,  7,903,903,135,903,903,  7,519,
+	519,  7,775,775,  7,519,1015,  7,519,519,  7,775,519,  7,519,775,
+	  7,519,519,  7,903,519,  7,519,775,  7,519,519,  7,775,519,  7,
+	519,903,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,967,
+	519,  7,519,775,  7,519,519,  7,775,775,  7,519,903,  7,519,519,
+	  7,775,519,  7,519,775,  7,519,519,  7,903,519,  7,775,775,  7,
+	519,519,  7,775,519,  7,519,967,  7,519,519,  7,775,519,  7,519,
+	775,  7,519,519,  7,903,519,  7,775,775,  7,519,519,  7,775,519,
+	  7,519,903,  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,
+	999,519,  7,775,775,  7,519,519,135,903,903,  7,903,903,  7,519,
+	519,  7,775,519,  7,519,775,  7,583,583, 71,967,967,199,967,967,
+	  7,519,519,199,967,967,  7,967,967,  7,519,519,  7,775,519,  7,
+	519,775,  7,519,519,  7,903,519,  7,519,775,  7,519,519,  7,775,
+	775,  7,519,903,  7,519,519,  7,775,519,  7,519,775,  7,519,519,
+	  7,967,967,199,967,967,  7,583,583,199,967,967, 71,967,967,  7,
+	519,519,  7,775,519,  7,519,775,  7,519,519,  7,903,903,135,903,
+	903,  7,519,519,  7,775,775,  7,519,999,  7,519,519,  7,775,519,
+	  7,519,775,  7,519,519,  7,903,519,  7,519,775,  7,519,519,  7,
+	775,519,  7,519,903,  7,519,519,  7,775,519,  7,519,775,  7,519,
+	519,  7,967,519,  7,775,775,  7,519,519,135,903,903,  7,903,903,
+	  7,519,519,  7,775,519,  7,519,775,  7,519,519,  7,903,903,135,
+	903,903,  7,519,519,  7,775,775,  7,519,967,  7,519,519,  7,775,
+	519,  7,519,775,  7,519,519,  7,903,519,  7,775,775,  7,519,519,
+	  7,775,775,  7,519,903,  7,519,519,  7,775,519,  7,519,775,  7,
+	519,519,  7,1023,1023,255,1023,1023,  7,639,639,255,1023,1023,127,1023,
+	1023,  7,519,519,  7,831,575, 63,575,831, 63,639,639,127,1023,1023,
+	255,1023,1023,  7,575,575,255,1023,1023, 63,1023,1023,  7,519,519,  7,
+	775,519,  7,519,775,  7,519,519,  7,927,543, 31,799,799,  7,543,
+	543,  7,799,799, 31,543,927,  7,543,543, 63,831,575, 31,575,831,
+	 31,575,575, 63,1023,1023,255,1023,1023, 63,639,639,255,1023,1023,127,
+	1023,1023,  7,519,519,  7,799,543, 31,543,799, 31,639,639,127,1023,
+	1023,255,1023,1023,  7,543,543,255,1023,1023, 31,1023,1023,  7,519,519,
+	  7,775,519,  7,519,775,  7,519,519,  7,903,519,  7,519,775,  7,
+	519,519,  7,775,519,  7,519,903,  7,519,519,  7,775,519,  7,519,
+	775,  7,519,519,  7,975,527, 15,783,783,  7,527,527,143,911,911,
+	 15,911,911,  7,519,519,  7,783,527, 15,527,783,  7,519,519,  7,
+	911,911,143,911,911,  7,527,527,  7,783,783, 15,527,975,  7,519,
+	519,  7,783,527, 15,527,783, 15,543,543, 31,927,543, 15,799,799,
+	  7,527,527, 31,799,799, 15,543,927,  7,527,527, 31,799,543, 15,
+	543,799, 15,543,543, 31,1023,1023,255,1023,1023, 31,639,639,255,1023,
+	1023,127,1023,1023, 15,543,543, 31,831,575, 63,575,831, 63,639,639,
+	127,1023,1023,255,1023,1023, 31,575,575,255,1023,1023, 63,1023,1023,  7,
+	519,519,  7,775,519,  7,519,775,  7,519,519,  7,911,527, 15,783,
+	783,  7,527,527,  7,783,783, 15,527,911,  7,527,527, 63,831,575,
+	 15,575,831, 15,575,575, 63,1023,1023,255,1023,1023, 63,639,639,255,
+	1023,1023,127,1023,1023,  7,519,519,  7,783,527, 15,527,783, 15,639,
+	639,127,1023,1023,255,1023,1023,  7,527,527,255,1023,1023, 15,1023,1023,
+	 15,527,527, 15,783,527, 15,527,783, 15,527,527, 15,911,527, 15,
+	527,783, 15,527,527, 15,783,527, 15,527,911, 15,527,527, 15,783,
+	527, 15,527,783, 15,527,527, 15,975,527, 15,527,783, 15,527,527,
+	 15,783,783, 15,527,911, 15,527,527, 15,783,527, 15,527,783, 15,
+	527,527, 15,911,527, 15,783,783, 15,527,527, 15,783,527, 15,527,
+	975, 15,527,527, 15,783,527, 15,527,783, 15,527,527, 15,911,527,
+	 15,783,783, 15,527,527, 15,783,527, 15,527,911, 15,527,527, 15,
+	783,527, 15,527,783, 15,527,527, 15,1007,527, 15,783,783, 15,527,
+	527,143,911,911, 15,911,911, 15,527,527, 15,783,527, 15,527,783,
+	 15,591,591, 79,975,975,207,975,975, 15,527,527,207,975,975, 15,
+	975,975, 15,527,527, 15,783,527, 15,527,783, 15,527,527, 15,911,
+	527, 15,527,783, 15,527,527, 15,783,783, 15,527,911, 15,527,527,
+	 15,783,527, 15,527,783, 15,527,527, 15,975,975,207,975,975, 15,
+	591,591,207,975,975, 79,975,975, 15,527,527, 15,783,527, 15,527,
+	783, 15,527,527, 15,911,911,143,911,911, 15,527,527, 15,783,783,
+	 15,527,1007, 15,527,527, 15,783,527, 15,527,783, 15,527,527, 15,
+	911,527, 15,527,783, 15,527,527, 15,783,527, 15,527,911, 15,527,
+	527, 15,783,527, 15,527,783, 15,527,527, 15,975,527, 15,783,783,
+	 15,527,527,143,911,911, 15,911,911, 15,527,527, 15,783,527, 15,
+	527,783, 15,527,527, 15,911,911,143,911,911, 15,527,527, 15,783,
+	783, 15,527,975, 15,527,527, 15,783,527, 15,527,783, 15,527,527,
+	 15,911,527, 15,783,783, 15,527,527, 15,783,783, 15,527,911, 15,
+	527,527, 15,783,527, 15,527,783, 15,527,527, 15,1023,1023,255,1023,
+	1023, 15,639,639,255,1023,1023,127,1023,1023, 15,527,527, 15,831,575,
+	 63,575,831, 63,639,639,127,1023,1023,255,1023,1023, 15,575,575,255,
+	1023,1023, 63,1023,1023, 15,527,527, 15,783,527, 15,527,783, 15,527,
+	527, 15,927,543, 31,799,799, 15,543,543, 15,799,799, 31,543,927,
+	 15,543,543, 63,831,575, 31,575,831, 31,575,575, 63,1023,1023,255,
+	1023,1023, 63,639,639,255,1023,1023,127,1023,1023, 15,527,527, 15,799,
+	543, 31,543,799, 31,639,639,127,1023,1023,255,1023,1023, 15,543,543,
+	255,1023,1023, 31,1023,1023, 31,543,543, 31,799,543, 31,543,799, 31,
+	543,543, 31,927,543, 31,543,799, 31,543,543, 31,799,543, 31,543,
+	927, 31,543,543, 31,799,543, 31,543,799, 31,543,543, 31,991,543,
+	 31,799,799, 31,543,543,159,927,927, 31,927,927, 31,543,543, 31,
+	799,543, 31,543,799, 31,543,543, 31,927,927,159,927,927, 31,543,
+	543, 31,799,799, 31,543,991, 31,543,543, 31,799,543, 31,543,799,
+	 31,543,543, 31,927,543, 31,799,799, 31,543,543, 31,799,799, 31,
+	543,927, 31,543,543, 31,799,543, 31,543,799, 31,543,543, 31,1023,
+	1023,255,1023,1023, 31,639,639,255,1023,1023,127,1023,1023, 31,543,543,
+	 31,831,575, 63,575,831, 63,639,639,127,1023,1023,255,1023,1023, 31,
+	575,575,255,1023,1023, 63,1023,1023, 63,575,575, 63,831,575, 63,575,
+	831, 63,575,575, 63,959,575, 63,831,831, 63,575,575, 63,831,831,
+	 63,575,959, 63,575,575, 63,831,575, 63,575,831, 63,575,575, 63,
+	1023,1023,255,1023,1023, 63,639,639,255,1023,1023,127,1023,1023,127,639,
+	639,127,895,639,127,639,895,127,639,639,127,1023,1023,255,1023,1023,
+	255,767,767,255,1023,1023,511,1023,1023
+};
+
+#endif
+
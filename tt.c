@@ -0,0 +1,140 @@
+#include <stdlib.h>
+#include <string.h>
+#include "tt.h"
+#include "memory.h"
+
+/* The table is an array of buckets of four entries, each bucket the
+	size of a cache line. An entry stores its packed data together
+	with the position's key xored with that data, so that an entry 
+	torn by a concurrent write simply fails to match. This lets 
+	several threads share one table without locking.
+
+	Data layout:  bits  0-31  score
+	              bits 32-39  depth
+	              bits 40-47  move (255 for a pass)
+	              bits 48-50  flag
+	              bits 56-63  age of the search that stored it */
+
+#define BUCKETSIZE 4
+
+struct ttentry {
+	uint64_t check;		/* key ^ data */
+	uint64_t data;
+};
+
+struct ttable {
+	struct ttentry *entries;
+	uint64_t mask;		/* Number of buckets - 1 */
+	int kind;			/* How the entries are backed (memory.h) */
+	unsigned int age;
+};
+
+#define DATA_DEPTH(d) ((int)(((d)>>32) & 0xff))
+#define DATA_AGE(d) ((unsigned int)((d)>>56))
+
+/** Create a table using at most the given number of bytes. */
+struct ttable *tt_create(size_t bytes) {
+	struct ttable *tt;
+	size_t buckets = 1;
+
+	while (buckets*2*BUCKETSIZE*sizeof(struct ttentry) <= bytes)
+		buckets *= 2;
+
+	if ((tt = malloc(sizeof *tt)) == NULL)
+		return NULL;
+	if ((tt->entries = mem_alloc(buckets*BUCKETSIZE*sizeof *tt->entries, &tt->kind)) == NULL) {
+		free(tt);
+		return NULL;
+	}
+	tt->mask = buckets-1;
+	tt->age = 0;
+	return tt;
+}
+
+void tt_destroy(struct ttable *tt) {
+	if (tt) {
+		mem_free(tt->entries, (tt->mask+1)*BUCKETSIZE*sizeof *tt->entries);
+		free(tt);
+	}
+}
+
+void tt_clear(struct ttable *tt) {
+	memset(tt->entries, 0, (tt->mask+1)*BUCKETSIZE*sizeof *tt->entries);
+}
+
+/** Bytes used by the entries of the table, at most the size it was
+	created with. If kind isn't NULL it is set to how they are backed
+	(MEM_NORMAL, MEM_HUGETLB or MEM_THP). */
+size_t tt_memory(struct ttable *tt, int *kind) {
+	if (kind)
+		*kind = tt->kind;
+	return (tt->mask+1)*BUCKETSIZE*sizeof *tt->entries;
+}
+
+/** Start loading the bucket of a position into the cache, ahead of
+	a probe or store. */
+void tt_prefetch(struct ttable *tt, uint64_t key) {
+#ifdef __GNUC__
+	__builtin_prefetch(tt->entries + (key & tt->mask)*BUCKETSIZE);
+#else
+	(void)tt;
+	(void)key;
+#endif
+}
+
+/** Entries from earlier searches are replaced first. */
+void tt_newsearch(struct ttable *tt) {
+	tt->age = (tt->age+1) & 0xff;
+}
+
+/** Look up a position. Returns nonzero and fills in *data if found. */
+int tt_probe(struct ttable *tt, uint64_t key, struct ttdata *data) {
+	struct ttentry *bucket = tt->entries + (key & tt->mask)*BUCKETSIZE;
+	uint64_t d;
+	int i;
+
+	for (i=0; i<BUCKETSIZE; i++) {
+		d = bucket[i].data;
+		if ((bucket[i].check ^ d) == key && d) {
+			data->score = (int32_t)(uint32_t)d;
+			data->depth = DATA_DEPTH(d);
+			data->move = (int)((d>>40) & 0xff);
+			if (data->move == 0xff)
+				data->move = -1;
+			data->flag = (int)((d>>48) & 7);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/** Store a search result. Overwrites the entry for the same position
+	if there is one, otherwise the shallowest entry from the oldest search. */
+void tt_store(struct ttable *tt, uint64_t key, int depth, int score, int flag, int move) {
+	struct ttentry *bucket = tt->entries + (key & tt->mask)*BUCKETSIZE;
+	struct ttentry *replace = bucket;
+	uint64_t d;
+	int i, worth, best = 1<<30;
+
+	for (i=0; i<BUCKETSIZE; i++) {
+		d = bucket[i].data;
+		if ((bucket[i].check ^ d) == key) {
+			replace = &bucket[i];
+			break;
+		}
+		// Prefer replacing old and shallow entries
+		worth = DATA_DEPTH(d) - 256*((tt->age - DATA_AGE(d)) & 0xff);
+		if (worth < best) {
+			best = worth;
+			replace = &bucket[i];
+		}
+	}
+
+	d = (uint64_t)(uint32_t)score
+		| (uint64_t)(depth & 0xff) << 32
+		| (uint64_t)(move & 0xff) << 40
+		| (uint64_t)flag << 48
+		| (uint64_t)tt->age << 56;
+	replace->data = d;
+	replace->check = key ^ d;
+}
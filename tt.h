@@ -0,0 +1,36 @@
+#ifndef TT_H
+#define TT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Kinds of scores stored in the transposition table
+#define TT_EXACT 0
+#define TT_LOWER 1	/* Search failed high: score is a lower bound */
+#define TT_UPPER 2	/* Search failed low: score is an upper bound */
+#define TT_SOLVED 4	/* Or'd into the above: the search behind the score
+						reached the end of the game on every line */
+
+#define TT_DEFAULTSIZE (1<<20)	/* Bytes */
+#define TT_MINSIZE 4096
+
+/** A transposition table entry as returned by tt_probe(). */
+struct ttdata {
+	int score;
+	int depth;
+	int flag;
+	int move;	/* Best move found, -1 for a pass or 0 if unknown */
+};
+
+struct ttable;
+
+struct ttable *tt_create(size_t bytes);
+void tt_destroy(struct ttable *tt);
+void tt_clear(struct ttable *tt);
+size_t tt_memory(struct ttable *tt, int *kind);
+void tt_prefetch(struct ttable *tt, uint64_t key);
+void tt_newsearch(struct ttable *tt);
+int tt_probe(struct ttable *tt, uint64_t key, struct ttdata *data);
+void tt_store(struct ttable *tt, uint64_t key, int depth, int score, int flag, int move);
+
+#endif